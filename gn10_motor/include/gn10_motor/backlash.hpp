@@ -0,0 +1,159 @@
+/**
+ * @file backlash.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief ギアのバックラッシ (遊び) を位置目標のオフセットで補償する
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#pragma once
+
+#include <cmath>
+#include <type_traits>
+
+namespace gn10_motor {
+
+/**
+ * @brief バックラッシ補償の設定 (SetBacklash で受信し、フラッシュに保存する)
+ */
+struct BacklashConfig {
+    float width_rad        = 0.0f;   ///< 遊びの幅 (エンコーダで測る角度) [rad] (0 で補償しない)
+    float traverse_rad_s   = 0.0f;   ///< 反転時に遊びを渡る速さ [rad/s] (0 で 1 周期で渡る)
+    bool freeze_integrator = false;  ///< 遊びを渡る間と遊びの中で PID の積分を止める
+};
+
+/**
+ * @brief 位置目標の移動方向に応じて遊びの半分のオフセットを足すバックラッシ補償
+ *
+ * 正転中は負荷側が遊びの幅の半分だけ遅れるため、目標値に +width / 2 を足す (逆転中は -width / 2)。
+ * 目標値の移動方向が反転したら、オフセットを traverse_rad_s の速さで反対側へ切り替え、
+ * 負荷が止まっている遊びの区間を PID の応答を待たずに渡り切る。
+ * 起動時・reset() の後は遊びの中央にいるとみなし、オフセット 0 から始める。
+ *
+ * 遊びの中ではモータを動かしても負荷が動かないため、積分を続けると遊びを渡った後に行き過ぎて
+ * リミットサイクルになる。hold_integral() でその区間を知らせる。
+ *
+ * @tparam T 浮動小数点型 (float, double)
+ */
+template <typename T>
+class BacklashCompensator
+{
+    static_assert(
+        std::is_floating_point_v<T>, "BacklashCompensator only supports floating point types."
+    );
+
+public:
+    BacklashCompensator()
+        : half_width_(T{0}),
+          traverse_rate_(T{0}),
+          previous_target_(T{0}),
+          direction_(T{0}),
+          offset_(T{0})
+    {
+    }
+
+    /**
+     * @brief 遊びの幅と渡る速さを設定する (オフセットは reset() するまで保持する)
+     * @param width_rad      遊びの幅 [rad] (0 以下で無効)
+     * @param traverse_rad_s 遊びを渡る速さ [rad/s] (0 以下で 1 周期で渡る)
+     */
+    void configure(T width_rad, T traverse_rad_s)
+    {
+        half_width_ = T{0};
+        if (width_rad > T{0}) {
+            half_width_ = width_rad * T{0.5};
+        }
+        traverse_rate_ = T{0};
+        if (traverse_rad_s > T{0}) {
+            traverse_rate_ = traverse_rad_s;
+        }
+    }
+
+    /**
+     * @brief 目標値の移動方向を更新し、オフセットを足した目標値を返す
+     * @param target 位置目標 [rad]
+     * @param dt     経過時間 [s]
+     * @return T 補償後の位置目標 [rad] (無効なら target)
+     */
+    T update(T target, T dt)
+    {
+        // 目標値が止まっている間は直前の方向を保つ
+        const T delta    = target - previous_target_;
+        previous_target_ = target;
+        if (delta > T{0}) {
+            direction_ = T{1};
+        } else if (delta < T{0}) {
+            direction_ = T{-1};
+        }
+        if (!enabled()) {
+            return target;
+        }
+
+        // 遊びの反対側へ、traverse_rate_ の速さでオフセットを移す
+        const T goal = direction_ * half_width_;
+        T step       = std::fabs(goal - offset_);
+        if (traverse_rate_ > T{0} && dt > T{0}) {
+            step = traverse_rate_ * dt;
+        }
+        if (offset_ < goal) {
+            offset_ = std::fmin(offset_ + step, goal);
+        } else {
+            offset_ = std::fmax(offset_ - step, goal);
+        }
+        return target + offset_;
+    }
+
+    /**
+     * @brief 遊びの中央で、目標値が target で止まっている状態にリセットする
+     * @param target 位置目標 [rad]
+     */
+    void reset(T target = T{0})
+    {
+        previous_target_ = target;
+        direction_       = T{0};
+        offset_          = T{0};
+    }
+
+    /**
+     * @brief 補償するかを返す
+     * @return true 遊びの幅が設定されている
+     */
+    bool enabled() const
+    {
+        return half_width_ > T{0};
+    }
+
+    /**
+     * @brief PID の積分を止めるべきかを返す
+     * @param error 補償後の位置目標 - 位置 [rad]
+     * @return true 反転して遊びを渡っている途中か、偏差が遊びの幅の半分より小さい
+     */
+    bool hold_integral(T error) const
+    {
+        if (!enabled()) {
+            return false;
+        }
+        return offset_ != direction_ * half_width_ || std::fabs(error) < half_width_;
+    }
+
+    /**
+     * @brief 現在のオフセットを返す
+     * @return T オフセット [rad]
+     */
+    T offset() const
+    {
+        return offset_;
+    }
+
+private:
+    T half_width_;       ///< 遊びの幅の半分 [rad]
+    T traverse_rate_;    ///< オフセットを切り替える速さ [rad/s] (0 で即時)
+    T previous_target_;  ///< 前回の位置目標 [rad]
+    T direction_;        ///< 目標値の移動方向 (+1, -1, 0: 未定)
+    T offset_;           ///< 位置目標に足しているオフセット [rad]
+};
+
+}  // namespace gn10_motor
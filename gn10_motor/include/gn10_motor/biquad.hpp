@@ -0,0 +1,227 @@
+/**
+ * @file biquad.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief 双2次 (biquad) フィルタの縦続接続 (ローパス・ノッチ)
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace gn10_motor {
+
+/**
+ * @brief biquad フィルタの種類
+ */
+enum class BiquadType : uint8_t {
+    None    = 0,  ///< 素通し (この段を使わない)
+    LowPass = 1,  ///< 2 次ローパス
+    Notch   = 2,  ///< ノッチ (cutoff_hz の共振を除く)
+};
+
+/**
+ * @brief biquad フィルタ 1 段の設定 (SetBiquad で受信し、フラッシュに保存する)
+ */
+struct BiquadConfig {
+    BiquadType type = BiquadType::None;
+    float cutoff_hz = 0.0f;  ///< 遮断周波数・ノッチの中心周波数 [Hz] (ナイキスト以上は素通し)
+    float q         = 0.0f;  ///< Q 値 (ノッチは中心周波数 / 除去帯域幅。0 以下は素通し)
+};
+
+/// MotorController の 1 か所に挿入できる biquad フィルタの段数
+constexpr std::size_t BIQUAD_STAGES = 2U;
+
+/**
+ * @brief MotorController に挿入する biquad フィルタの設定
+ */
+struct BiquadFilters {
+    std::array<BiquadConfig, BIQUAD_STAGES> feedback{};  ///< フィードバック値 (PID の入力)
+    std::array<BiquadConfig, BIQUAD_STAGES> output{};    ///< PID の出力 (デューティ)
+};
+
+/**
+ * @brief 直接形 II 転置 (DF2T) の biquad フィルタを N 段縦続接続したフィルタ
+ *
+ * 係数は RBJ Audio EQ Cookbook の式で (種類, 周波数, Q) からボード上で計算する。
+ * 係数の並び ({b0, b1, b2, -a1, -a2} / 段) と 1 段の計算は CMSIS-DSP の
+ * arm_biquad_cascade_df2T_f32 と同じで、1 段あたり乗算 5 回・加算 4 回になる。
+ * 係数は set_stage() と dt の変化時だけ計算し直す。
+ *
+ * ローパス・ノッチとも直流ゲインは 1 のため、reset() では入力が一定値で落ち着いた状態にする。
+ *
+ * @tparam T 浮動小数点型 (float, double)
+ * @tparam N 段数
+ */
+template <typename T, std::size_t N>
+class BiquadCascade
+{
+    static_assert(std::is_floating_point_v<T>, "BiquadCascade only supports floating point types.");
+
+public:
+    BiquadCascade() : stages_{}, dt_(T{0}), active_(false), resync_(true) {}
+
+    /**
+     * @brief 1 段の設定を変更する (状態は reset() するまで保持する)
+     * @param index  段の番号 (N 以上は無視する)
+     * @param config 設定
+     */
+    void set_stage(std::size_t index, const BiquadConfig& config)
+    {
+        if (index >= N) {
+            return;
+        }
+        stages_[index].config = config;
+        if (dt_ > T{0}) {
+            design(stages_[index]);
+        }
+        update_active();
+    }
+
+    /**
+     * @brief フィルタを 1 サンプル進める
+     * @param input 入力
+     * @param dt    サンプリング周期 [s]
+     * @return T 出力 (有効な段がなければ入力をそのまま返す)
+     */
+    T update(T input, T dt)
+    {
+        if (!active_ || dt <= T{0}) {
+            return input;
+        }
+        // 周期が変わったら係数を計算し直し、状態を今の入力で落ち着いた状態にする
+        if (dt != dt_) {
+            dt_ = dt;
+            for (Stage& stage : stages_) {
+                design(stage);
+            }
+            resync_ = true;
+        }
+        if (resync_) {
+            reset(input);
+        }
+
+        T x = input;
+        for (Stage& stage : stages_) {
+            const T y = stage.b0 * x + stage.d1;
+            stage.d1  = stage.b1 * x + stage.a1 * y + stage.d2;
+            stage.d2  = stage.b2 * x + stage.a2 * y;
+            x         = y;
+        }
+        return x;
+    }
+
+    /**
+     * @brief 入力が value で一定のときの状態にリセットする
+     * @param value 入力 (= 出力) の値
+     */
+    void reset(T value = T{0})
+    {
+        for (Stage& stage : stages_) {
+            stage.d1 = value - stage.b0 * value;
+            stage.d2 = stage.b2 * value + stage.a2 * value;
+        }
+        resync_ = false;
+    }
+
+    /**
+     * @brief 次の update() の入力で落ち着いた状態にリセットする
+     *        入力が不連続に変わる (エンコーダの積算角度を戻すなど) ときに使用
+     */
+    void resync()
+    {
+        resync_ = true;
+    }
+
+    /**
+     * @brief 素通しでない段があるかを返す
+     * @return true フィルタが入力を変える
+     */
+    bool active() const
+    {
+        return active_;
+    }
+
+private:
+    /**
+     * @brief 1 段の設定・係数 ({b0, b1, b2, -a1, -a2}、a0 で正規化済み) と状態
+     */
+    struct Stage {
+        BiquadConfig config;
+        T b0 = T{1};
+        T b1 = T{0};
+        T b2 = T{0};
+        T a1 = T{0};
+        T a2 = T{0};
+        T d1 = T{0};
+        T d2 = T{0};
+    };
+
+    /**
+     * @brief 設定と dt_ から係数を計算する (設定が無効なら素通しの係数にする)
+     * @param stage 計算する段
+     */
+    void design(Stage& stage) const
+    {
+        const BiquadConfig& config = stage.config;
+        const T cutoff             = static_cast<T>(config.cutoff_hz);
+        const T q                  = static_cast<T>(config.q);
+        const T nyquist            = T{0.5} / dt_;
+
+        stage.b0 = T{1};
+        stage.b1 = T{0};
+        stage.b2 = T{0};
+        stage.a1 = T{0};
+        stage.a2 = T{0};
+        if (config.type == BiquadType::None || !(cutoff > T{0}) || !(cutoff < nyquist) ||
+            !(q > T{0})) {
+            return;
+        }
+
+        constexpr T TWO_PI = static_cast<T>(6.283185307179586);
+        const T omega      = TWO_PI * cutoff * dt_;
+        const T cos_omega  = std::cos(omega);
+        const T alpha      = std::sin(omega) / (T{2} * q);
+        const T a0         = T{1} + alpha;
+
+        if (config.type == BiquadType::LowPass) {
+            stage.b1 = (T{1} - cos_omega) / a0;
+            stage.b0 = stage.b1 / T{2};
+            stage.b2 = stage.b0;
+        } else {
+            stage.b0 = T{1} / a0;
+            stage.b1 = T{-2} * cos_omega / a0;
+            stage.b2 = stage.b0;
+        }
+        stage.a1 = T{2} * cos_omega / a0;
+        stage.a2 = (alpha - T{1}) / a0;
+    }
+
+    /**
+     * @brief 素通しでない種類の段があるかを更新する
+     */
+    void update_active()
+    {
+        active_ = false;
+        for (const Stage& stage : stages_) {
+            if (stage.config.type != BiquadType::None) {
+                active_ = true;
+            }
+        }
+    }
+
+    std::array<Stage, N> stages_;
+    T dt_;  ///< 係数を計算したときのサンプリング周期 [s]
+    bool active_;
+    bool resync_;  ///< 次の update() の入力で reset() するなら true
+};
+
+}  // namespace gn10_motor
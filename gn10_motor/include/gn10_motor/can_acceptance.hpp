@@ -0,0 +1,80 @@
+/**
+ * @file can_acceptance.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief ボード ID に基づく CAN 受信フィルタ (ID / マスク) の定義
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#pragma once
+
+#include <cstdint>
+
+#include "gn10_motor/extension_protocol.hpp"
+
+namespace gn10_motor::can_acceptance {
+
+/**
+ * @brief 標準 ID のマスクフィルタ
+ *        (受信 ID & mask) == (id & mask) のとき一致する
+ */
+struct IDFilter {
+    uint32_t id;
+    uint32_t mask;
+};
+
+// ---------------------------------------------------------------------------
+// gn10_can の標準 ID 割り当て
+//
+//   bit [10:7] デバイス種別 / bit [6:3] デバイス ID (= board_id) / bit [2:0] コマンド
+//
+// gn10_can 側の割り当てを変更した場合はここを合わせること。
+// 一致しないとモーター制御フレームがハードウェアで破棄され、ボードが応答しなくなる。
+// ---------------------------------------------------------------------------
+
+/// デバイス種別フィールドの開始ビット
+constexpr uint32_t DEVICE_TYPE_SHIFT = 7U;
+
+/// デバイス種別フィールドのマスク
+constexpr uint32_t DEVICE_TYPE_MASK = 0x0FU << DEVICE_TYPE_SHIFT;
+
+/// モータードライバーのデバイス種別 (gn10_can の DeviceType::MotorDriver)
+constexpr uint32_t MOTOR_DRIVER_DEVICE_TYPE = 1U;
+
+/// デバイス ID フィールドの開始ビット
+constexpr uint32_t DEVICE_ID_SHIFT = 3U;
+
+/// デバイス ID フィールドのマスク
+constexpr uint32_t DEVICE_ID_MASK = 0x0FU << DEVICE_ID_SHIFT;
+
+/**
+ * @brief 自ボード宛て gn10_can フレームのフィルタを返す
+ *        デバイス種別も照合するため、拡張プロトコルの ID 帯 (0x700-0x7FF) には一致しない
+ *        (除外用のフィルタを置けない bxCAN でも拡張コマンドが Rx FIFO0 に入らない)
+ * @param board_id DIP スイッチのボード ID [0-15]
+ * @return IDFilter デバイス種別 (モータードライバー) とデバイス ID を照合するフィルタ
+ */
+constexpr IDFilter gn10_can_filter(uint8_t board_id)
+{
+    return IDFilter{
+        (MOTOR_DRIVER_DEVICE_TYPE << DEVICE_TYPE_SHIFT) |
+            (static_cast<uint32_t>(board_id) << DEVICE_ID_SHIFT),
+        DEVICE_TYPE_MASK | DEVICE_ID_MASK
+    };
+}
+
+/**
+ * @brief 拡張プロトコルが使用する ID 帯 (0x700-0x7FF)
+ *        他ボード宛ての拡張コマンド・他ボードの応答を gn10_can_filter() より先に除外する
+ */
+constexpr IDFilter EXTENSION_RANGE = {extension::COMMAND_BASE_ID, 0x700U};
+
+static_assert(
+    (gn10_can_filter(0).id & EXTENSION_RANGE.mask) != EXTENSION_RANGE.id,
+    "gn10_can_filter() must not match the extension ID range."
+);
+
+}  // namespace gn10_motor::can_acceptance
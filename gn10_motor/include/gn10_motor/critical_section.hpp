@@ -0,0 +1,50 @@
+/**
+ * @file critical_section.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief スコープの間だけ割り込みを禁止する
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#pragma once
+
+#include <cstdint>
+
+namespace gn10_motor {
+
+/**
+ * @brief 生成から破棄までの間、割り込みを禁止する
+ *
+ * 受信割り込みが書き込む設定と更新フラグを、優先度の低い制御周期の割り込みから
+ * まとめて取り出すときに使う。PRIMASK を保存して復元するため、入れ子にしてもよい。
+ * Cortex-M 以外 (ホスト用のツール) では割り込みがないため何もしない。
+ */
+class CriticalSection
+{
+public:
+    CriticalSection() : primask_(0U)
+    {
+#if defined(__ARM_ARCH_PROFILE) && (__ARM_ARCH_PROFILE == 'M')
+        __asm volatile("mrs %0, primask" : "=r"(primask_));
+        __asm volatile("cpsid i" ::: "memory");
+#endif
+    }
+
+    ~CriticalSection()
+    {
+#if defined(__ARM_ARCH_PROFILE) && (__ARM_ARCH_PROFILE == 'M')
+        __asm volatile("msr primask, %0" ::"r"(primask_) : "memory");
+#endif
+    }
+
+    CriticalSection(const CriticalSection&)            = delete;
+    CriticalSection& operator=(const CriticalSection&) = delete;
+
+private:
+    uint32_t primask_;  ///< 禁止する前の PRIMASK
+};
+
+}  // namespace gn10_motor
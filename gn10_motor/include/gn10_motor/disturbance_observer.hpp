@@ -0,0 +1,169 @@
+/**
+ * @file disturbance_observer.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief 公称モデルの逆系と Q フィルタによる外乱オブザーバ
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+
+namespace gn10_motor {
+
+/**
+ * @brief 外乱オブザーバの動作
+ */
+enum class DisturbanceMode : uint8_t {
+    Off        = 0,  ///< 推定しない
+    Estimate   = 1,  ///< 推定してフィードバックで通知するだけ (出力は変えない)
+    Compensate = 2,  ///< 推定値を PID の出力に足して外乱を打ち消す
+};
+
+/**
+ * @brief 外乱オブザーバの設定 (SetDisturbance で受信し、フラッシュに保存する)
+ *
+ * 公称モデルはデューティ u から角速度 ω までの 1 次遅れ dω/dt = gain × u - ω / time_constant。
+ */
+struct DisturbanceConfig {
+    DisturbanceMode mode  = DisturbanceMode::Off;
+    float cutoff_rad_s    = 0.0f;  ///< Q フィルタの遮断角周波数 [rad/s]
+    float gain_rad_s2     = 0.0f;  ///< デューティ 1.0 あたりの角加速度 [rad/s^2]
+    float time_constant_s = 0.0f;  ///< 機械的時定数 [s] (0 で粘性摩擦なしの積分器とみなす)
+};
+
+/**
+ * @brief 速度制御系の外乱オブザーバ
+ *
+ * 入力 u と角速度 ω から、公称モデルの逆系で「ω を出すのに必要だった入力」を求め、
+ * 実際の入力との差を 1 次ローパス Q(s) = g / (s + g) に通して外乱を推定する。
+ *
+ *   d = Q(s) × (u - (s + 1/τ) ω / gain)
+ *
+ * s Q(s) ω = g (ω - Q(s) ω) と書き換えて、ω を微分せずに 2 つのローパスだけで計算する。
+ * 推定値はデューティ換算の負荷 (負荷トルク / ストールトルク に相当) で、
+ * 入力に足すと外乱を打ち消せる。1 周期の計算量は乗算 6 回程度。
+ *
+ * @tparam T 浮動小数点型 (float, double)
+ */
+template <typename T>
+class DisturbanceObserver
+{
+    static_assert(
+        std::is_floating_point_v<T>, "DisturbanceObserver only supports floating point types."
+    );
+
+public:
+    DisturbanceObserver()
+        : cutoff_(T{0}),
+          inverse_gain_(T{0}),
+          damping_(T{0}),
+          dt_(T{0}),
+          smoothing_(T{0}),
+          filtered_input_(T{0}),
+          filtered_velocity_(T{0}),
+          estimate_(T{0})
+    {
+    }
+
+    /**
+     * @brief 公称モデルと Q フィルタを設定する
+     * @param cutoff_rad_s    Q フィルタの遮断角周波数 [rad/s] (0 以下で無効)
+     * @param gain_rad_s2     入力 1.0 あたりの角加速度 [rad/s^2] (0 以下で無効)
+     * @param time_constant_s 機械的時定数 [s] (0 以下で積分器)
+     */
+    void configure(T cutoff_rad_s, T gain_rad_s2, T time_constant_s)
+    {
+        cutoff_       = T{0};
+        inverse_gain_ = T{0};
+        damping_      = T{0};
+        if (cutoff_rad_s > T{0} && gain_rad_s2 > T{0}) {
+            cutoff_       = cutoff_rad_s;
+            inverse_gain_ = T{1} / gain_rad_s2;
+        }
+        if (time_constant_s > T{0}) {
+            damping_ = T{1} / time_constant_s;
+        }
+        if (dt_ > T{0}) {
+            smoothing_ = T{1} - std::exp(-cutoff_ * dt_);
+        }
+    }
+
+    /**
+     * @brief 1 周期分の推定を行う
+     * @param input    前の周期に出力した入力 (デューティ)
+     * @param velocity その周期の角速度 [rad/s]
+     * @param dt       経過時間 [s]
+     * @return T 外乱の推定値 (入力の単位)
+     */
+    T update(T input, T velocity, T dt)
+    {
+        if (dt <= T{0} || !enabled()) {
+            return estimate_;
+        }
+        if (dt != dt_) {
+            dt_        = dt;
+            smoothing_ = T{1} - std::exp(-cutoff_ * dt_);
+        }
+
+        filtered_input_ += smoothing_ * (input - filtered_input_);
+        filtered_velocity_ += smoothing_ * (velocity - filtered_velocity_);
+
+        // Q(s) (s + 1/τ) ω = g (ω - Q(s) ω) + Q(s) ω / τ
+        const T required =
+            cutoff_ * (velocity - filtered_velocity_) + damping_ * filtered_velocity_;
+        estimate_ = filtered_input_ - required * inverse_gain_;
+        return estimate_;
+    }
+
+    /**
+     * @brief 入力と角速度が一定で続いていた状態にリセットする
+     * @param input    入力
+     * @param velocity 角速度 [rad/s]
+     */
+    void reset(T input = T{0}, T velocity = T{0})
+    {
+        filtered_input_    = input;
+        filtered_velocity_ = velocity;
+        estimate_          = T{0};
+        if (enabled()) {
+            estimate_ = input - damping_ * velocity * inverse_gain_;
+        }
+    }
+
+    /**
+     * @brief 推定を行うかを返す
+     * @return true 遮断角周波数とゲインが設定されている
+     */
+    bool enabled() const
+    {
+        return cutoff_ > T{0};
+    }
+
+    /**
+     * @brief 外乱の推定値を返す
+     * @return T 推定値 (入力の単位。正なら正転を妨げる負荷)
+     */
+    T estimate() const
+    {
+        return estimate_;
+    }
+
+private:
+    T cutoff_;
+    T inverse_gain_;
+    T damping_;  ///< 1 / 時定数 [1/s]
+    T dt_;       ///< smoothing_ を計算したときの周期 [s]
+    T smoothing_;
+    T filtered_input_;
+    T filtered_velocity_;
+    T estimate_;
+};
+
+}  // namespace gn10_motor
@@ -0,0 +1,292 @@
+/**
+ * @file extension_protocol.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief gn10_can の MotorDriver メッセージを補う拡張コマンドの ID・ペイロード定義
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace gn10_motor::extension {
+
+// ---------------------------------------------------------------------------
+// CAN ID (11-bit 標準 ID)
+// ---------------------------------------------------------------------------
+
+/// ボード ID の数 (4-bit DIP スイッチ)
+constexpr uint8_t BOARD_ID_COUNT = 16U;
+
+/// ホスト → ボード 拡張コマンドの基底 ID (実 ID = COMMAND_BASE_ID + board_id)
+constexpr uint32_t COMMAND_BASE_ID = 0x700U;
+
+/// ボード → ホスト 拡張応答の基底 ID (実 ID = REPLY_BASE_ID + board_id)
+constexpr uint32_t REPLY_BASE_ID = 0x710U;
+
+/// ホスト → 全ボード 拡張コマンドの ID
+constexpr uint32_t BROADCAST_ID = 0x720U;
+
+/// クラシック CAN の最大ペイロード長 [byte]
+constexpr uint8_t CLASSIC_PAYLOAD_LENGTH = 8U;
+
+/// CAN FD の最大ペイロード長 [byte]
+constexpr uint8_t FD_PAYLOAD_LENGTH = 64U;
+
+/**
+ * @brief 自ボード宛て拡張コマンドの ID を返す
+ * @param board_id DIP スイッチのボード ID [0-15]
+ * @return uint32_t CAN ID
+ */
+constexpr uint32_t command_id(uint8_t board_id)
+{
+    return COMMAND_BASE_ID + board_id;
+}
+
+/**
+ * @brief 自ボードの拡張応答の ID を返す
+ * @param board_id DIP スイッチのボード ID [0-15]
+ * @return uint32_t CAN ID
+ */
+constexpr uint32_t reply_id(uint8_t board_id)
+{
+    return REPLY_BASE_ID + board_id;
+}
+
+// ---------------------------------------------------------------------------
+// コマンド (ペイロード先頭 1 バイト)
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief 拡張コマンド種別
+ *
+ * | コマンド           | ペイロード (data[1] 以降, リトルエンディアン)              |
+ * |--------------------|-----------------------------------------------------------|
+ * | SetFeedbackPolicy  | mode:u8, period_cycles:u16, delta_threshold:f32           |
+ * | RequestFeedback    | なし                                                      |
+ * | SetFrameFormat     | fd_enabled:u8                                             |
+ * | SetGains (FD)      | kp:f32, ki:f32, kd:f32                                    |
+ * | SetSyncMode        | latch_enabled:u8, phase_align:u8                          |
+ * | Sync               | なし (BROADCAST_ID で送信する)                            |
+ * | TimeSyncRequest    | seq:u8                                                    |
+ * | SetClock           | reserved:u8, time_us:u48                                  |
+ * | AdjustClock        | reserved:u8, delta_us:i32                                 |
+ * | SetFeedbackStamp   | enabled:u8                                                |
+ * | SaveParameters     | key:u8 (PARAMETER_KEY)                                    |
+ * | RestoreParameters  | なし                                                      |
+ * | ClearParameters    | key:u8 (PARAMETER_KEY)                                    |
+ * | RequestBootProfile | phase:u8 (BootPhase)                                      |
+ * | SetMotionLimits    | decel_ratio:u8 (/255), reserved:u16, jerk_per_s2:f32      |
+ * | SetTimeoutPolicy   | action:u8 (TimeoutAction), decel_ratio:u8 (/255)          |
+ * | StartHoming        | reserved:u8, backoff_mrad:u16, speed_rad_s:f32            |
+ * | SetPositionLimit   | bound:u8, decel_rad_s2:u16, position_rad:f32              |
+ * | SetObserver        | reserved:u8, bandwidth_rad_s:u16, input_gain_rad_s2:f32   |
+ * | SetBiquad          | location:u8, stage:u8, type:u8, cutoff_hz:u16, q:u16      |
+ * | SetDisturbance     | mode:u8, cutoff_rad_s:u16, gain_rad_s2:u16, tau_ms:u16    |
+ * | SetInputShaper     | type:u8, damping:u16 (/10000), frequency_hz:f32           |
+ * | SetBacklash        | flags:u8, traverse_rad_s:u16, width_rad:f32               |
+ * | CalibrateFriction  | revolutions:u8, reserved:u16, speed_rad_s:f32             |
+ * | SetFriction        | enabled:u8                                                |
+ */
+enum class Command : uint8_t {
+    SetFeedbackPolicy  = 0x01,  ///< フィードバック送信ポリシーの設定
+    RequestFeedback    = 0x02,  ///< 次の制御周期でフィードバックを1回送信させる
+    SetFrameFormat     = 0x03,  ///< フィードバックを CAN FD の拡張フィードバックに切り替える
+    SetGains           = 0x04,  ///< PID ゲインを1フレームで一括設定する (CAN FD のみ)
+    SetSyncMode        = 0x05,  ///< 目標値を Sync 受信まで保留するか、制御周期を Sync に揃えるか
+    Sync               = 0x06,  ///< 保留中の目標値を全ボード同時に適用する
+    TimeSyncRequest    = 0x07,  ///< 時刻同期要求 (受信時刻・折り返し時間を TimeSyncReply で返す)
+    SetClock           = 0x08,  ///< ボード時刻を設定する (初回の粗い同期用)
+    AdjustClock        = 0x09,  ///< ボード時刻を補正する (TimeSyncReply から求めた誤差)
+    SetFeedbackStamp   = 0x0A,  ///< クラシック CAN のフィードバックに時刻フレームを付ける
+    SaveParameters     = 0x0B,  ///< 現在の設定・ゲインをフラッシュへ保存する
+    RestoreParameters  = 0x0C,  ///< フラッシュの設定を読み直し、一時的な上書きを破棄する
+    ClearParameters    = 0x0D,  ///< フラッシュの設定を消去する (次回起動時はホストの init を待つ)
+    RequestBootProfile = 0x0E,  ///< 起動フェーズの到達時刻を BootProfile で返させる
+    SetMotionLimits    = 0x0F,  ///< 減速側の加速度制限と躍度制限を設定する
+    SetTimeoutPolicy   = 0x10,  ///< 目標値の受信途絶時の停止方法を設定する
+    StartHoming        = 0x11,  ///< LIM1 を使った原点復帰を開始する (speed_rad_s = 0 で中止)
+    SetPositionLimit   = 0x12,  ///< 位置制御の可動範囲の下限・上限を設定する (±inf で解除)
+    SetObserver        = 0x13,  ///< 位置・速度の推定に使う追従オブザーバを設定する
+    SetBiquad          = 0x14,  ///< フィードバック・出力の biquad フィルタを 1 段設定する
+    SetDisturbance     = 0x15,  ///< 負荷を推定する外乱オブザーバを設定する
+    SetInputShaper     = 0x16,  ///< 目標値の入力整形 (振動モードの抑制) を設定する
+    SetBacklash        = 0x17,  ///< 位置制御のバックラッシ補償を設定する (width_rad = 0 で解除)
+    CalibrateFriction  = 0x18,  ///< 一定速の往復で摩擦のマップを校正する (speed_rad_s = 0 で中止)
+    SetFriction        = 0x19,  ///< 摩擦のマップによるフィードフォワードの有効・無効を切り替える
+};
+
+/**
+ * @brief SetPositionLimit で設定する可動範囲の境界
+ */
+enum class PositionBound : uint8_t {
+    Min = 0x00,  ///< 下限
+    Max = 0x01,  ///< 上限
+};
+
+/**
+ * @brief SetBiquad で設定する biquad フィルタの挿入位置
+ */
+enum class BiquadLocation : uint8_t {
+    Feedback = 0x00,  ///< フィードバック値 (PID の入力)
+    Output   = 0x01,  ///< PID の出力 (max_duty_ratio・加減速制限の前)
+};
+
+/// SaveParameters / ClearParameters の誤送信防止キー
+constexpr uint8_t PARAMETER_KEY = 0xA5U;
+
+/// SetMotionLimits / SetTimeoutPolicy の decel_ratio の分母 (decel_ratio = u8 / MOTION_RATIO_SCALE)
+constexpr float MOTION_RATIO_SCALE = 255.0f;
+
+/// StartHoming の backoff_mrad の分母 (backoff_rad = u16 / HOMING_BACKOFF_SCALE)
+constexpr float HOMING_BACKOFF_SCALE = 1000.0f;
+
+/// SetObserver の bandwidth_rad_s の上限 (1 ms の制御周期で TrackingObserver::MAX_BANDWIDTH_DT)
+constexpr uint16_t OBSERVER_MAX_BANDWIDTH_RAD_S = 500U;
+
+/// SetBiquad の q の分母 (q = u16 / BIQUAD_Q_SCALE)
+constexpr float BIQUAD_Q_SCALE = 1000.0f;
+
+/// SetDisturbance の tau_ms の分母 (time_constant_s = u16 / DISTURBANCE_TAU_SCALE)
+constexpr float DISTURBANCE_TAU_SCALE = 1000.0f;
+
+/// SetInputShaper の damping の分母 (damping_ratio = u16 / SHAPER_DAMPING_SCALE)
+constexpr float SHAPER_DAMPING_SCALE = 10000.0f;
+
+/// SetBacklash の flags: 遊びを渡る間と遊びの中で PID の積分を止める
+constexpr uint8_t BACKLASH_FREEZE_INTEGRATOR = 0x01U;
+
+/**
+ * @brief 拡張応答種別 (ボード → ホスト, ペイロード先頭 1 バイト)
+ *
+ * | 応答             | ペイロード (data[1] 以降, リトルエンディアン)                      |
+ * |------------------|-------------------------------------------------------------------|
+ * | ExtendedFeedback | limit_switch:u8, fault:u8, reserved:u8, position_rad:f32,         |
+ * | (FD, 32 byte)    | velocity_rad_s:f32, duty:f32, current_a:f32,                      |
+ * |                  | temperature_degc:f32, sample_time_us:u64                          |
+ * | TimeSyncReply    | seq:u8, rx_time_us:u32 (下位 32-bit), turnaround_us:u16           |
+ * | FeedbackStamp    | reserved:u8, sample_time_us:u48                                   |
+ * | ParameterResult  | command:u8, success:u8                                            |
+ * | BootProfile      | phase:u8, reached:u8, elapsed_us:u32                              |
+ * | HomingResult     | status:u8 (HomingStatus), reserved:u16, origin_rad:f32            |
+ * | Disturbance      | reserved:u8, reserved:u16, disturbance_duty:f32                   |
+ * | FrictionResult   | status:u8, positive:i16, negative:i16, ripple:i16 (/32767)        |
+ */
+enum class Reply : uint8_t {
+    ExtendedFeedback = 0x01,  ///< 位置・速度・デューティ等をまとめたフィードバック
+    TimeSyncReply    = 0x02,  ///< TimeSyncRequest への応答
+    FeedbackStamp    = 0x03,  ///< 直前のフィードバックのエンコーダサンプリング時刻
+    ParameterResult  = 0x04,  ///< Save / Restore / ClearParameters の処理結果
+    BootProfile      = 0x05,  ///< RequestBootProfile への応答
+    HomingResult     = 0x06,  ///< 原点復帰の終了 (成功・中止) の通知
+    Disturbance      = 0x07,  ///< 外乱オブザーバの推定値 (フィードバックの直後に送る)
+    FrictionResult   = 0x08,  ///< 摩擦の校正の終了 (成功・中止) の通知
+};
+
+/**
+ * @brief ExtendedFeedback で通知する異常コード
+ */
+enum class FaultCode : uint8_t {
+    None               = 0x00,  ///< 異常なし
+    UnsupportedEncoder = 0x01,  ///< 未対応のエンコーダタイプが設定された
+    PositionLimit      = 0x02,  ///< 位置が SetPositionLimit の可動範囲を超えた
+};
+
+/**
+ * @brief HomingResult で通知する原点復帰の結果
+ */
+enum class HomingStatus : uint8_t {
+    Succeeded = 0x00,  ///< 原点を設定し、退避位置で停止した
+    Cancelled = 0x01,  ///< speed_rad_s = 0 の StartHoming または init の受信で中止した
+    Rejected  = 0x02,  ///< init 受信前、または IncrementalTotal 以外のため開始しなかった
+    TimedOut  = 0x03,  ///< 目標値の受信が途絶えたため中止した
+};
+
+/**
+ * @brief FrictionResult で通知する摩擦の校正の結果
+ */
+enum class FrictionStatus : uint8_t {
+    Succeeded = 0x00,  ///< 往復を終えてマップを更新した
+    Cancelled = 0x01,  ///< speed_rad_s = 0 の CalibrateFriction・init・原点復帰の開始で中止した
+    Rejected  = 0x02,  ///< init 受信前、位置制御でない、または原点復帰中のため開始しなかった
+    TimedOut  = 0x03,  ///< 目標値の受信が途絶えたため中止した
+    Failed    = 0x04,  ///< 記録のない区間が残った (1 回転分動けなかった)
+};
+
+/**
+ * @brief 起動フェーズ (BootProfile で main() 先頭からの経過時間を返す)
+ */
+enum class BootPhase : uint8_t {
+    ClockConfigured        = 0x00,  ///< システムクロックの設定完了
+    PeripheralsInitialized = 0x01,  ///< 制御に必要な周辺機能の初期化完了 (setup() 開始)
+    ControlStarted         = 0x02,  ///< 制御タイマーの起動 (setup() 完了)
+    FirstControlTick       = 0x03,  ///< 最初の制御周期
+    DeferredInitDone       = 0x04,  ///< センサ等の遅延初期化完了
+    Count,                          ///< フェーズ数
+};
+
+// ---------------------------------------------------------------------------
+// ペイロードのエンコード / デコード
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief リトルエンディアンのバイト列から値を読み出す
+ * @tparam T 算術型
+ * @param data 読み出し位置
+ * @return T 読み出した値
+ */
+template <typename T>
+T read_le(const uint8_t* data)
+{
+    static_assert(std::is_arithmetic_v<T>, "read_le only supports arithmetic types.");
+    // Cortex-M / x86 はいずれもリトルエンディアンのため memcpy で足りる
+    T value;
+    std::memcpy(&value, data, sizeof(T));
+    return value;
+}
+
+/**
+ * @brief 値をリトルエンディアンのバイト列として書き込む
+ * @tparam T 算術型
+ * @param data  書き込み位置
+ * @param value 書き込む値
+ */
+template <typename T>
+void write_le(uint8_t* data, T value)
+{
+    static_assert(std::is_arithmetic_v<T>, "write_le only supports arithmetic types.");
+    std::memcpy(data, &value, sizeof(T));
+}
+
+/// 48-bit 時刻フィールドのバイト数
+constexpr uint8_t TIME_48_LENGTH = 6U;
+
+/**
+ * @brief 48-bit リトルエンディアンの時刻を読み出す
+ * @param data 読み出し位置
+ * @return uint64_t 時刻 [us]
+ */
+inline uint64_t read_le_u48(const uint8_t* data)
+{
+    uint64_t value = 0U;
+    std::memcpy(&value, data, TIME_48_LENGTH);
+    return value;
+}
+
+/**
+ * @brief 時刻の下位 48-bit をリトルエンディアンで書き込む
+ * @param data  書き込み位置
+ * @param value 時刻 [us]
+ */
+inline void write_le_u48(uint8_t* data, uint64_t value)
+{
+    std::memcpy(data, &value, TIME_48_LENGTH);
+}
+
+}  // namespace gn10_motor::extension
@@ -0,0 +1,389 @@
+/**
+ * @file extension_server.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief 拡張コマンドの受信・保持クラス
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "gn10_motor/backlash.hpp"
+#include "gn10_motor/biquad.hpp"
+#include "gn10_motor/disturbance_observer.hpp"
+#include "gn10_motor/extension_protocol.hpp"
+#include "gn10_motor/feedback_scheduler.hpp"
+#include "gn10_motor/friction_map.hpp"
+#include "gn10_motor/homing.hpp"
+#include "gn10_motor/i_clock.hpp"
+#include "gn10_motor/i_extension_transmitter.hpp"
+#include "gn10_motor/input_shaper.hpp"
+#include "gn10_motor/jerk_limiter.hpp"
+#include "gn10_motor/position_limits.hpp"
+#include "gn10_motor/timeout_policy.hpp"
+#include "gn10_motor/tracking_observer.hpp"
+
+namespace gn10_motor {
+
+/**
+ * @brief 拡張フィードバック (CAN FD) の内容
+ */
+struct ExtendedFeedback {
+    float position_rad         = 0.0f;
+    float velocity_rad_s       = 0.0f;
+    float duty                 = 0.0f;  ///< 出力デューティ [-1.0, 1.0]
+    float current_a            = 0.0f;  ///< 未計測のボードでは NaN
+    float temperature_degc     = 0.0f;  ///< 未計測のボードでは NaN
+    uint8_t limit_switch       = 0;
+    extension::FaultCode fault = extension::FaultCode::None;
+    uint64_t sample_time_us    = 0;  ///< エンコーダのサンプリング時刻 (同期済みボード時刻)
+};
+
+/**
+ * @brief フラッシュのパラメータに対する操作要求
+ */
+enum class ParameterAction : uint8_t {
+    None,     ///< 要求なし
+    Save,     ///< 現在の設定を保存する
+    Restore,  ///< 保存済みの設定を読み直す
+    Clear,    ///< 保存済みの設定を消去する
+};
+
+/**
+ * @brief 拡張コマンドの受信・保持クラス
+ *
+ * gn10_can の MotorDriverServer が扱わない設定 (フィードバック送信ポリシー等) を
+ * extension_protocol.hpp の ID で受け取り、応答を IExtensionTransmitter で送信する。
+ *
+ * CAN 受信割り込み  ： ExtensionServer::on_receive()
+ *
+ * タイマー割り込み ： MotorController が get_new_*() で polling する
+ *
+ * CAN 受信割り込みはタイマー割り込みより優先度が高いため、get_new_*() は受信データのコピーと
+ * 更新フラグの解除を CriticalSection の中で行い、途中で書き換えられた設定や
+ * 解除の直前に届いた更新を取りこぼさないようにする。
+ *
+ * ボード時刻 (now_us()) は IClock の値にホストとの時刻同期で求めたオフセットを加えたもの。
+ * オフセットの変更と TimeSyncReply の送信は service_time_sync() (タイマー割り込み) で行い、
+ * CAN 受信割り込みでは受信時刻の記録だけを行う。
+ */
+class ExtensionServer
+{
+public:
+    /**
+     * @brief コンストラクタ
+     * @param board_id    DIP スイッチのボード ID [0-15]
+     * @param transmitter 応答の送信先
+     * @param clock       フリーランのボード時刻
+     */
+    ExtensionServer(uint8_t board_id, IExtensionTransmitter& transmitter, IClock& clock);
+
+    /**
+     * @brief 受信フレームを解釈する (CAN 受信割り込みから呼ぶ)
+     * @param id     CAN ID
+     * @param data   ペイロード
+     * @param length ペイロード長 [byte]
+     * @return true 自ボード宛ての拡張コマンドとして処理した
+     */
+    bool on_receive(uint32_t id, const uint8_t* data, uint8_t length);
+
+    /**
+     * @brief 新しいフィードバック送信ポリシーを取得する
+     * @param policy 受信済みポリシーの格納先
+     * @return true 前回取得以降に新しいポリシーを受信した
+     */
+    bool get_new_feedback_policy(FeedbackPolicy& policy);
+
+    /**
+     * @brief フィードバック送信要求の有無を取得し、要求をクリアする
+     * @return true 前回取得以降に送信要求を受信した
+     */
+    bool get_feedback_request();
+
+    /**
+     * @brief 一括設定された PID ゲインを取得する
+     * @param gains {kp, ki, kd} の格納先
+     * @return true 前回取得以降に新しいゲインを受信した
+     */
+    bool get_new_gains(std::array<float, 3>& gains);
+
+    /**
+     * @brief 新しい加減速制限の設定を取得する
+     * @param limits 受信済み設定の格納先
+     * @return true 前回取得以降に SetMotionLimits を受信した
+     */
+    bool get_new_motion_limits(MotionLimits& limits);
+
+    /**
+     * @brief 新しいタイムアウト時の停止方法を取得する
+     * @param policy 受信済み設定の格納先
+     * @return true 前回取得以降に SetTimeoutPolicy を受信した
+     */
+    bool get_new_timeout_policy(TimeoutPolicy& policy);
+
+    /**
+     * @brief 原点復帰の開始・中止要求を取得する
+     * @param config 受信済み設定の格納先 (speed_rad_s = 0 は中止要求)
+     * @return true 前回取得以降に StartHoming を受信した
+     */
+    bool get_new_homing(HomingConfig& config);
+
+    /**
+     * @brief 原点復帰の結果を送信する
+     * @param status     結果
+     * @param origin_rad 起動時 (init 受信時) の原点からみた現在の原点の位置 [rad]
+     * @return true 送信キューへ積めた
+     */
+    bool send_homing_result(extension::HomingStatus status, float origin_rad);
+
+    /**
+     * @brief 新しい可動範囲の設定を取得する
+     *        前回取得以降に SetPositionLimit を受信した境界と減速度だけを limits に上書きする
+     * @param limits 現在の設定 (受信済みの値で更新する)
+     * @return true 前回取得以降に SetPositionLimit を受信した
+     */
+    bool get_new_position_limits(PositionLimits& limits);
+
+    /**
+     * @brief 新しい追従オブザーバの設定を取得する
+     * @param config 受信済み設定の格納先
+     * @return true 前回取得以降に SetObserver を受信した
+     */
+    bool get_new_observer(ObserverConfig& config);
+
+    /**
+     * @brief 新しい biquad フィルタの設定を取得する
+     *        前回取得以降に SetBiquad を受信した段だけを filters に上書きする
+     * @param filters 現在の設定 (受信済みの値で更新する)
+     * @return true 前回取得以降に SetBiquad を受信した
+     */
+    bool get_new_biquads(BiquadFilters& filters);
+
+    /**
+     * @brief 新しい外乱オブザーバの設定を取得する
+     * @param config 受信済み設定の格納先
+     * @return true 前回取得以降に SetDisturbance を受信した
+     */
+    bool get_new_disturbance(DisturbanceConfig& config);
+
+    /**
+     * @brief 外乱オブザーバの推定値を送信する (フィードバックの直後に送る)
+     * @param disturbance_duty デューティ換算の負荷の推定値
+     * @return true 送信キューへ積めた
+     */
+    bool send_disturbance(float disturbance_duty);
+
+    /**
+     * @brief 新しい入力整形の設定を取得する
+     * @param config 受信済み設定の格納先
+     * @return true 前回取得以降に SetInputShaper を受信した
+     */
+    bool get_new_input_shaper(InputShaperConfig& config);
+
+    /**
+     * @brief 新しいバックラッシ補償の設定を取得する
+     * @param config 受信済み設定の格納先
+     * @return true 前回取得以降に SetBacklash を受信した
+     */
+    bool get_new_backlash(BacklashConfig& config);
+
+    /**
+     * @brief 摩擦の校正の開始・中止要求を取得する
+     * @param config 受信済み設定の格納先 (speed_rad_s = 0 は中止要求)
+     * @return true 前回取得以降に CalibrateFriction を受信した
+     */
+    bool get_new_friction_calibration(FrictionCalibration& config);
+
+    /**
+     * @brief 摩擦のフィードフォワードの有効・無効の変更を取得する
+     * @param enabled 受信済みの値の格納先
+     * @return true 前回取得以降に SetFriction を受信した
+     */
+    bool get_new_friction_enabled(bool& enabled);
+
+    /**
+     * @brief 摩擦の校正の結果を送信する
+     * @param status 結果
+     * @param map    現在のマップ (位置によらない摩擦を通知する)
+     * @param ripple 位置ごとの負荷の最大値 (デューティ)
+     * @return true 送信キューへ積めた
+     */
+    bool send_friction_result(
+        extension::FrictionStatus status, const FrictionMap& map, float ripple
+    );
+
+    /**
+     * @brief Sync 受信の有無を取得し、クリアする (目標値の適用用)
+     * @return true 前回取得以降に Sync を受信した
+     */
+    bool get_sync();
+
+    /**
+     * @brief 制御周期の位相合わせ要求の有無を取得し、クリアする
+     *        位相合わせが有効な状態で Sync を受信すると要求される。
+     *        受信からの遅延を揃えるため、CAN 受信割り込み内で取得すること
+     * @return true 前回取得以降に位相合わせ要求があった
+     */
+    bool get_phase_align_request();
+
+    /**
+     * @brief パラメータ操作要求を取得し、クリアする
+     * @return ParameterAction 前回取得以降に受信した操作 (なければ None)
+     */
+    ParameterAction get_parameter_action();
+
+    /**
+     * @brief パラメータ操作の結果を送信する
+     * @param action  実行した操作
+     * @param success 成功したか
+     * @return true 送信キューへ積めた
+     */
+    bool send_parameter_result(ParameterAction action, bool success);
+
+    /**
+     * @brief 起動時間の計測値の要求を取得し、クリアする
+     * @param phase 要求された起動フェーズの格納先
+     * @return true 前回取得以降に RequestBootProfile を受信した
+     */
+    bool get_boot_profile_request(extension::BootPhase& phase);
+
+    /**
+     * @brief 起動フェーズの到達時刻を送信する
+     * @param phase      起動フェーズ
+     * @param reached    フェーズに到達済みか
+     * @param elapsed_us main() 先頭からの経過時間 [us]
+     * @return true 送信キューへ積めた
+     */
+    bool send_boot_profile(extension::BootPhase phase, bool reached, uint32_t elapsed_us);
+
+    /**
+     * @brief 目標値を Sync 受信まで保留するかを返す
+     * @return true SetSyncMode で保留が有効化されている
+     */
+    bool sync_latch_enabled() const
+    {
+        return sync_latch_enabled_;
+    }
+
+    /**
+     * @brief 時刻同期コマンドを処理する (タイマー割り込みから毎制御周期呼ぶ)
+     *        SetClock / AdjustClock を適用し、TimeSyncRequest を受信していれば応答を送信する
+     */
+    void service_time_sync();
+
+    /**
+     * @brief 同期済みのボード時刻を返す
+     *        タイマー割り込みから呼ぶこと (オフセットの更新と競合しないため)
+     * @return uint64_t ボード時刻 [us]
+     */
+    uint64_t now_us()
+    {
+        return clock_.now_us() + static_cast<uint64_t>(clock_offset_us_);
+    }
+
+    /**
+     * @brief クラシック CAN のフィードバックに時刻フレームを付けるかを返す
+     * @return true SetFeedbackStamp で有効化されている
+     */
+    bool feedback_stamp_enabled() const
+    {
+        return feedback_stamp_enabled_;
+    }
+
+    /**
+     * @brief フィードバックのサンプリング時刻を送信する (クラシック CAN 用)
+     * @param sample_time_us エンコーダのサンプリング時刻 [us]
+     * @return true 送信キューへ積めた
+     */
+    bool send_feedback_stamp(uint64_t sample_time_us);
+
+    /**
+     * @brief 拡張フィードバックを送信する
+     * @param feedback 送信内容
+     * @return true 送信キューへ積めた
+     */
+    bool send_extended_feedback(const ExtendedFeedback& feedback);
+
+    /**
+     * @brief フィードバックを CAN FD の拡張フィードバックで送るかを返す
+     * @return true SetFrameFormat で有効化され、かつ送信側が CAN FD に対応している
+     */
+    bool fd_enabled() const
+    {
+        return fd_enabled_;
+    }
+
+    /**
+     * @brief ボード ID を返す
+     * @return uint8_t ボード ID [0-15]
+     */
+    uint8_t board_id() const
+    {
+        return board_id_;
+    }
+
+private:
+    const uint8_t board_id_;
+    IExtensionTransmitter& transmitter_;
+    IClock& clock_;
+
+    /// ボード時刻のオフセット [us] (タイマー割り込みでのみ変更する)
+    int64_t clock_offset_us_;
+
+    // --- 受信データ (割り込み間で共有するためフラグは volatile) ---
+    FeedbackPolicy feedback_policy_;
+    std::array<float, 3> gains_;
+    MotionLimits motion_limits_;
+    TimeoutPolicy timeout_policy_;
+    HomingConfig homing_;
+    PositionLimits position_limits_;
+    ObserverConfig observer_;
+    BiquadFilters biquads_;
+    DisturbanceConfig disturbance_;
+    InputShaperConfig input_shaper_;
+    BacklashConfig backlash_;
+    FrictionCalibration friction_calibration_;
+    volatile bool feedback_policy_updated_;
+    volatile bool feedback_requested_;
+    volatile bool gains_updated_;
+    volatile bool motion_limits_updated_;
+    volatile bool timeout_policy_updated_;
+    volatile bool homing_requested_;
+    volatile bool position_min_updated_;
+    volatile bool position_max_updated_;
+    volatile bool observer_updated_;
+    volatile uint8_t biquad_updated_;  ///< SetBiquad を受信した段のビットマップ
+    volatile bool disturbance_updated_;
+    volatile bool input_shaper_updated_;
+    volatile bool backlash_updated_;
+    volatile bool friction_calibration_requested_;
+    volatile bool friction_enabled_;
+    volatile bool friction_enabled_updated_;
+    volatile bool fd_enabled_;
+    volatile bool sync_latch_enabled_;
+    volatile bool phase_align_enabled_;
+    volatile bool sync_received_;
+    volatile bool phase_align_requested_;
+    volatile bool feedback_stamp_enabled_;
+    volatile ParameterAction parameter_action_;
+    volatile bool boot_profile_requested_;
+    extension::BootPhase boot_profile_phase_;
+
+    // --- 時刻同期 (受信時刻は IClock の値。処理待ちの間は次の要求を受け付けない) ---
+    uint64_t time_sync_rx_us_;    ///< TimeSyncRequest の受信時刻
+    uint8_t time_sync_seq_;       ///< TimeSyncRequest のシーケンス番号
+    uint64_t set_clock_rx_us_;    ///< SetClock の受信時刻
+    uint64_t set_clock_time_us_;  ///< SetClock で指定された時刻
+    int32_t adjust_clock_us_;     ///< AdjustClock で指定された補正量
+    volatile bool time_sync_pending_;
+    volatile bool set_clock_pending_;
+    volatile bool adjust_clock_pending_;
+};
+
+}  // namespace gn10_motor
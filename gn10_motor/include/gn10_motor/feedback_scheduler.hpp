@@ -0,0 +1,129 @@
+/**
+ * @file feedback_scheduler.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief フィードバック送信タイミングの判定クラス
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+namespace gn10_motor {
+
+/**
+ * @brief フィードバック送信モード
+ */
+enum class FeedbackMode : uint8_t {
+    EveryCycle = 0,  ///< 毎制御周期送信 (従来動作)
+    Decimate   = 1,  ///< period_cycles 周期ごとに送信
+    OnChange   = 2,  ///< 変化量が閾値以上、または period_cycles 周期無送信で送信
+    Polled     = 3,  ///< ホストからの要求時のみ送信
+};
+
+/**
+ * @brief フィードバック送信ポリシー
+ */
+struct FeedbackPolicy {
+    FeedbackMode mode      = FeedbackMode::EveryCycle;
+    uint16_t period_cycles = 1;     ///< Decimate: 送信間隔 / OnChange: 最大無送信周期 (0: 無制限)
+    float delta_threshold  = 0.0f;  ///< OnChange: 前回送信値からの変化量の閾値
+};
+
+/**
+ * @brief フィードバックを送信すべき制御周期かを判定する
+ *
+ * バス負荷を台数ではなく状態変化の速さに比例させるため、毎周期送信を
+ * 間引き・変化検出・ホスト要求の各モードに切り替える。
+ * どのモードでも request() による要求があれば次の周期で送信する。
+ */
+class FeedbackScheduler
+{
+public:
+    /**
+     * @brief 送信ポリシーを設定する
+     * @param policy 新しいポリシー
+     */
+    void set_policy(const FeedbackPolicy& policy)
+    {
+        policy_ = policy;
+        if (policy_.mode == FeedbackMode::Decimate && policy_.period_cycles == 0) {
+            policy_.period_cycles = 1;
+        }
+        // 切り替え直後の状態をホストへ確実に伝えるため、次の周期で1回送信する
+        request_pending_ = true;
+    }
+
+    /**
+     * @brief 現在の送信ポリシーを返す
+     * @return const FeedbackPolicy& 送信ポリシー
+     */
+    const FeedbackPolicy& policy() const
+    {
+        return policy_;
+    }
+
+    /**
+     * @brief 次の判定で送信させる (ホストからのポーリング要求)
+     */
+    void request()
+    {
+        request_pending_ = true;
+    }
+
+    /**
+     * @brief 今回の制御周期で送信すべきかを判定する (毎制御周期1回呼ぶ)
+     * @param value              今回のフィードバック値
+     * @param limit_switch_state 今回のリミットスイッチ状態
+     * @return true 送信する (送信済みとして内部状態を更新する)
+     */
+    bool should_send(float value, uint8_t limit_switch_state)
+    {
+        if (cycles_since_sent_ < UINT16_MAX) {
+            ++cycles_since_sent_;
+        }
+
+        bool send = request_pending_;
+        switch (policy_.mode) {
+            case FeedbackMode::EveryCycle:
+                send = true;
+                break;
+
+            case FeedbackMode::Decimate:
+                send = send || (cycles_since_sent_ >= policy_.period_cycles);
+                break;
+
+            case FeedbackMode::OnChange:
+                send = send || (std::fabs(value - last_value_) >= policy_.delta_threshold) ||
+                       (limit_switch_state != last_limit_switch_state_) ||
+                       (policy_.period_cycles != 0 && cycles_since_sent_ >= policy_.period_cycles);
+                break;
+
+            case FeedbackMode::Polled:
+            default:
+                break;
+        }
+
+        if (send) {
+            last_value_              = value;
+            last_limit_switch_state_ = limit_switch_state;
+            cycles_since_sent_       = 0;
+            request_pending_         = false;
+        }
+        return send;
+    }
+
+private:
+    FeedbackPolicy policy_;
+    uint16_t cycles_since_sent_      = 0;
+    float last_value_                = 0.0f;
+    uint8_t last_limit_switch_state_ = 0;
+    bool request_pending_            = false;
+};
+
+}  // namespace gn10_motor
@@ -0,0 +1,233 @@
+/**
+ * @file friction_map.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief 摩擦・位置に依存する負荷のマップ (ボード上で校正するフィードフォワード)
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace gn10_motor {
+
+/// 1 回転あたりのマップの区間数 (2 のべき乗)
+constexpr std::size_t FRICTION_MAP_BINS = 256U;
+
+/// マップに格納するデューティの分母 (duty = int16 / FRICTION_MAP_SCALE)
+constexpr float FRICTION_MAP_SCALE = 32767.0f;
+
+/// 位置 1 rad あたりの区間数
+constexpr float FRICTION_BINS_PER_RAD =
+    static_cast<float>(FRICTION_MAP_BINS) / 6.283185307179586f;
+
+static_assert(
+    (FRICTION_MAP_BINS & (FRICTION_MAP_BINS - 1U)) == 0U,
+    "FRICTION_MAP_BINS must be a power of two."
+);
+
+/**
+ * @brief 摩擦の校正の設定 (CalibrateFriction で受信する)
+ */
+struct FrictionCalibration {
+    float speed_rad_s   = 0.0f;  ///< 校正する速さ [rad/s] (0 で中止)
+    uint8_t revolutions = 1U;    ///< 1 方向あたりに記録する回転数
+};
+
+/**
+ * @brief 摩擦・位置に依存する負荷のマップ (CalibrateFriction で校正し、フラッシュに保存する)
+ *
+ * 一定速で動かすのに必要なデューティを、回転方向ごとの摩擦 (位置によらない分) と、
+ * 1 回転を FRICTION_MAP_BINS に分けた位置ごとの負荷 (コギング・偏荷重) に分けて持つ。
+ */
+struct FrictionMap {
+    bool enabled            = false;  ///< フィードフォワードを出力に足す (SetFriction)
+    float speed_rad_s       = 0.0f;   ///< 校正した速さ [rad/s] (0 で校正していない)
+    float friction_positive = 0.0f;   ///< 正転に必要なデューティ (位置によらない分)
+    float friction_negative = 0.0f;   ///< 逆転に必要なデューティの大きさ (位置によらない分)
+
+    /// 位置ごとの負荷 (デューティ × FRICTION_MAP_SCALE、全区間の平均は 0)
+    std::array<int16_t, FRICTION_MAP_BINS> position_duty{};
+};
+
+/**
+ * @brief 区間の番号 (負も可) をマップの添字に折り返す
+ * @param bin 位置 × FRICTION_BINS_PER_RAD の整数部
+ * @return uint32_t 添字 [0, FRICTION_MAP_BINS)
+ */
+inline uint32_t friction_bin_index(float bin)
+{
+    // 負の番号も 2 のべき乗のマスクで 1 回転分の添字に折り返す
+    constexpr uint32_t MASK = static_cast<uint32_t>(FRICTION_MAP_BINS - 1U);
+    return static_cast<uint32_t>(static_cast<int32_t>(bin)) & MASK;
+}
+
+/**
+ * @brief デューティをマップの固定小数点に変換する
+ * @param duty デューティ
+ * @return int16_t duty × FRICTION_MAP_SCALE ([-1.0, 1.0] に制限)
+ */
+inline int16_t friction_to_fixed(float duty)
+{
+    const float clamped = std::fmin(std::fmax(duty, -1.0f), 1.0f);
+    return static_cast<int16_t>(std::lround(clamped * FRICTION_MAP_SCALE));
+}
+
+/**
+ * @brief マップから摩擦を打ち消すデューティを求める (隣り合う区間を線形補間する)
+ * @param map          マップ
+ * @param position_rad 位置 [rad] (校正したときと同じ原点)
+ * @param direction    回転方向 (+1: 正転, -1: 逆転, 0: 停止中で位置ごとの負荷だけ)
+ * @return float フィードフォワードのデューティ (校正していなければ 0)
+ */
+inline float friction_feedforward(const FrictionMap& map, float position_rad, float direction)
+{
+    if (!(map.speed_rad_s > 0.0f)) {
+        return 0.0f;
+    }
+
+    const float scaled   = position_rad * FRICTION_BINS_PER_RAD;
+    const float bin      = std::floor(scaled);
+    const uint32_t lower = friction_bin_index(bin);
+    const uint32_t upper = friction_bin_index(bin + 1.0f);
+    const float low      = static_cast<float>(map.position_duty[lower]);
+    const float high     = static_cast<float>(map.position_duty[upper]);
+    float duty           = (low + (high - low) * (scaled - bin)) / FRICTION_MAP_SCALE;
+
+    if (direction > 0.0f) {
+        duty += map.friction_positive;
+    } else if (direction < 0.0f) {
+        duty -= map.friction_negative;
+    }
+    return duty;
+}
+
+/**
+ * @brief 一定速の往復で出力したデューティを位置ごとに平均し、FrictionMap を作る
+ *
+ * 正転で 1 区間ずつデューティを足し込み、finish_forward() で平均をマップに仮置きする。
+ * 逆転も同様に足し込み、finish_backward() で
+ *   friction_positive = 正転の平均、friction_negative = -逆転の平均、
+ *   position_duty     = (正転 + 逆転) / 2 から平均を除いた分
+ * に分ける。偏荷重 (重力など) は friction_positive と friction_negative の差に入る。
+ *
+ * 足し込み用に float と uint16_t を FRICTION_MAP_BINS 個ずつ (1.5 KB) 持つ。
+ */
+class FrictionCalibrator
+{
+public:
+    FrictionCalibrator() : sums_{}, counts_{}, ripple_(0.0f) {}
+
+    /**
+     * @brief 1 方向の足し込みを始める
+     */
+    void begin_pass()
+    {
+        sums_.fill(0.0f);
+        counts_.fill(0U);
+    }
+
+    /**
+     * @brief 出力したデューティを位置の区間に足し込む
+     * @param position_rad 位置 [rad]
+     * @param duty         その位置で出力したデューティ
+     */
+    void add(float position_rad, float duty)
+    {
+        const uint32_t index = friction_bin_index(std::floor(position_rad * FRICTION_BINS_PER_RAD));
+        if (counts_[index] == UINT16_MAX) {
+            return;
+        }
+        sums_[index] += duty;
+        ++counts_[index];
+    }
+
+    /**
+     * @brief 正転の平均をマップに仮置きする
+     * @param map 書き込み先 (position_duty と friction_positive を上書きする)
+     * @return true 全区間を記録できた
+     */
+    bool finish_forward(FrictionMap& map)
+    {
+        if (!average()) {
+            return false;
+        }
+        float total = 0.0f;
+        for (std::size_t i = 0; i < FRICTION_MAP_BINS; ++i) {
+            total += sums_[i];
+            map.position_duty[i] = friction_to_fixed(sums_[i]);
+        }
+        map.friction_positive = total / static_cast<float>(FRICTION_MAP_BINS);
+        return true;
+    }
+
+    /**
+     * @brief 逆転の平均と仮置きした正転の平均からマップを完成させる
+     * @param map         finish_forward() で仮置きしたマップ
+     * @param speed_rad_s 校正した速さ [rad/s]
+     * @return true 全区間を記録できた
+     */
+    bool finish_backward(FrictionMap& map, float speed_rad_s)
+    {
+        if (!average()) {
+            return false;
+        }
+        float total = 0.0f;
+        for (std::size_t i = 0; i < FRICTION_MAP_BINS; ++i) {
+            total += sums_[i];
+        }
+        const float mean_backward = total / static_cast<float>(FRICTION_MAP_BINS);
+        const float mean_forward  = map.friction_positive;
+
+        ripple_ = 0.0f;
+        for (std::size_t i = 0; i < FRICTION_MAP_BINS; ++i) {
+            const float forward =
+                static_cast<float>(map.position_duty[i]) / FRICTION_MAP_SCALE - mean_forward;
+            const float backward = sums_[i] - mean_backward;
+            const float duty     = (forward + backward) * 0.5f;
+            map.position_duty[i] = friction_to_fixed(duty);
+            ripple_              = std::fmax(ripple_, std::fabs(duty));
+        }
+        map.friction_negative = -mean_backward;
+        map.speed_rad_s       = speed_rad_s;
+        return true;
+    }
+
+    /**
+     * @brief 最後に完成させたマップの位置ごとの負荷の最大値を返す
+     * @return float デューティの絶対値の最大値
+     */
+    float ripple() const
+    {
+        return ripple_;
+    }
+
+private:
+    /**
+     * @brief 各区間の合計を平均に置き換える
+     * @return true 全区間に 1 つ以上の記録があった
+     */
+    bool average()
+    {
+        for (std::size_t i = 0; i < FRICTION_MAP_BINS; ++i) {
+            if (counts_[i] == 0U) {
+                return false;
+            }
+            sums_[i] /= static_cast<float>(counts_[i]);
+        }
+        return true;
+    }
+
+    std::array<float, FRICTION_MAP_BINS> sums_;
+    std::array<uint16_t, FRICTION_MAP_BINS> counts_;
+    float ripple_;
+};
+
+}  // namespace gn10_motor
@@ -0,0 +1,27 @@
+/**
+ * @file homing.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief リミットスイッチを使った原点復帰の設定
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#pragma once
+
+namespace gn10_motor {
+
+/**
+ * @brief 原点復帰の設定 (StartHoming で受信する)
+ *
+ * speed_rad_s の向きに LIM1 を探し、スイッチが入ったエッジの位置を原点にする。
+ * その後 backoff_rad だけ逆向きに戻り、スイッチから離れた位置で停止する。
+ */
+struct HomingConfig {
+    float speed_rad_s = 0.0f;  ///< 速度 [rad/s] (符号で LIM1 へ向かう向きを指定。0 で中止)
+    float backoff_rad = 0.0f;  ///< エッジ検出後に戻る距離 [rad]
+};
+
+}  // namespace gn10_motor
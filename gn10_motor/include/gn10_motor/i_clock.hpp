@@ -0,0 +1,37 @@
+/**
+ * @file i_clock.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief ボード時刻の抽象インターフェース
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#pragma once
+
+#include <cstdint>
+
+namespace gn10_motor {
+
+/**
+ * @brief ボード時刻の抽象インターフェース
+ *
+ * 起動からの経過時間を 64-bit [us] で返す。ホストとの時刻同期による補正は
+ * ExtensionServer が行うため、実装はフリーランのカウンタをそのまま返せばよい。
+ * 割り込みの優先度に関わらず呼び出せること。
+ */
+class IClock
+{
+public:
+    virtual ~IClock() = default;
+
+    /**
+     * @brief 現在のボード時刻を返す
+     * @return uint64_t 起動からの経過時間 [us] (単調増加)
+     */
+    virtual uint64_t now_us() = 0;
+};
+
+}  // namespace gn10_motor
@@ -1,7 +1,7 @@
 /**
  * @file i_encoder.hpp
  * @author Gento Aiba (aiba-gento)
- * @brief インクリメンタルエンコーダの抽象インターフェース
+ * @brief エンコーダの抽象インターフェース
  * @version 0.2.0
  * @date 2026-02-23
  *
@@ -16,9 +16,10 @@
 namespace gn10_motor {
 
 /**
- * @brief インクリメンタルエンコーダの抽象インターフェース
+ * @brief エンコーダの抽象インターフェース
  *
  * ハードウェアタイマーのカウンタを読み取り、角速度・積算角度を提供する。
+ * アブソリュートエンコーダも前回読み取りからの差分カウントとして同じインターフェースで扱う。
  * read_and_reset_count() はカウンタ読み取りと同時にリセットを行うため、
  * 呼び出し側は毎制御周期に1回だけ呼び出すこと。
  */
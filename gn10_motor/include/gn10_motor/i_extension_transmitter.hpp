@@ -0,0 +1,45 @@
+/**
+ * @file i_extension_transmitter.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief 拡張コマンド応答の送信インターフェース
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#pragma once
+
+#include <cstdint>
+
+namespace gn10_motor {
+
+/**
+ * @brief 拡張コマンド応答の送信インターフェース
+ *
+ * CAN ペリフェラルごとの具象クラスはこのインターフェースを継承して実装する。
+ * 8 バイトを超えるペイロードは CAN FD (BRS あり) で送信する。
+ */
+class IExtensionTransmitter
+{
+public:
+    virtual ~IExtensionTransmitter() = default;
+
+    /**
+     * @brief フレームを送信キューへ積む
+     * @param id     CAN ID (11-bit 標準 ID)
+     * @param data   ペイロード
+     * @param length ペイロード長 [byte] (max_payload_length() 以下)
+     * @return true 送信キューへ積めた
+     */
+    virtual bool send(uint32_t id, const uint8_t* data, uint8_t length) = 0;
+
+    /**
+     * @brief 1 フレームで送信できる最大ペイロード長を返す
+     * @return uint8_t 8 (クラシック CAN) または 64 (CAN FD)
+     */
+    virtual uint8_t max_payload_length() const = 0;
+};
+
+}  // namespace gn10_motor
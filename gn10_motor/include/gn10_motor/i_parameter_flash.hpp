@@ -0,0 +1,69 @@
+/**
+ * @file i_parameter_flash.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief パラメータ保存用フラッシュ領域の抽象インターフェース
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#pragma once
+
+#include <cstdint>
+
+namespace gn10_motor {
+
+/**
+ * @brief パラメータ保存用フラッシュ領域の抽象インターフェース
+ *
+ * 同じ大きさの消去単位 (ページ) を page_count() 個持つ専用領域を表す。
+ * 消去後のバイトは 0xFF とし、書き込みは PROGRAM_UNIT バイト単位で行う。
+ */
+class IParameterFlash
+{
+public:
+    /// 書き込み単位 [byte] (offset / length はこの倍数であること)
+    static constexpr uint32_t PROGRAM_UNIT = 8U;
+
+    virtual ~IParameterFlash() = default;
+
+    /**
+     * @brief 1 ページの大きさを返す
+     * @return uint32_t ページサイズ [byte]
+     */
+    virtual uint32_t page_size() const = 0;
+
+    /**
+     * @brief ページ数を返す
+     * @return uint8_t ページ数 (2 以上)
+     */
+    virtual uint8_t page_count() const = 0;
+
+    /**
+     * @brief ページを消去する
+     * @param page ページ番号
+     * @return true 消去に成功した
+     */
+    virtual bool erase_page(uint8_t page) = 0;
+
+    /**
+     * @brief ページ内に書き込む (書き込み先は消去済みであること)
+     * @param page   ページ番号
+     * @param offset ページ先頭からのオフセット [byte]
+     * @param data   書き込むデータ
+     * @param length 書き込むバイト数
+     * @return true 書き込みに成功した
+     */
+    virtual bool program(uint8_t page, uint32_t offset, const uint8_t* data, uint32_t length) = 0;
+
+    /**
+     * @brief ページの内容を返す (メモリマップされた読み取り)
+     * @param page ページ番号
+     * @return const uint8_t* ページ先頭へのポインタ
+     */
+    virtual const uint8_t* page_data(uint8_t page) const = 0;
+};
+
+}  // namespace gn10_motor
@@ -0,0 +1,259 @@
+/**
+ * @file input_shaper.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief 目標値の入力整形 (ZV / ZVD / EI) による残留振動の抑制
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace gn10_motor {
+
+/**
+ * @brief 入力整形のインパルス列の種類
+ */
+enum class InputShaperType : uint8_t {
+    None = 0,  ///< 整形しない
+    ZV   = 1,  ///< Zero Vibration (2 インパルス、遅れ 半周期)
+    ZVD  = 2,  ///< Zero Vibration and Derivative (3 インパルス、遅れ 1 周期)
+    EI   = 3,  ///< Extra Insensitive (3 インパルス、遅れ 1 周期、残留振動 5% 許容)
+};
+
+/**
+ * @brief 入力整形の設定 (SetInputShaper で受信し、フラッシュに保存する)
+ */
+struct InputShaperConfig {
+    InputShaperType type = InputShaperType::None;
+    float frequency_hz   = 0.0f;  ///< 抑制する振動モードの固有振動数 [Hz]
+    float damping_ratio  = 0.0f;  ///< 振動モードの減衰比 [0, 1)
+};
+
+/// MotorController の入力整形の遅延線の長さ [サンプル] (1 ms 周期で 256 ms まで遅らせられる)
+constexpr std::size_t SHAPER_LENGTH = 256U;
+
+/**
+ * @brief 目標値の列にインパルス列を畳み込む入力整形器
+ *
+ * 振動モードの減衰固有周期 Td の半周期ごとに、振動を打ち消す振幅のインパルスを並べ、
+ * 過去 N サンプルの目標値を保持する遅延線と畳み込む。インパルスの振幅の和は 1 のため、
+ * 目標値の到達点は変わらず、ステップ状の目標値は Td / 2 (ZV) または Td (ZVD, EI) かけて
+ * 段階的に変化する。インパルスの時刻はサンプルの間を線形補間する。
+ *
+ * 遅れが遅延線に収まらない (振動数が低すぎる) 設定や、無効な設定では整形しない。
+ * EI の振幅は減衰なしの近似式 (残留振動の許容 5%) を使う。
+ *
+ * @tparam T 浮動小数点型 (float, double)
+ * @tparam N 遅延線の長さ [サンプル]
+ */
+template <typename T, std::size_t N>
+class InputShaper
+{
+    static_assert(std::is_floating_point_v<T>, "InputShaper only supports floating point types.");
+    static_assert(N >= 2U, "InputShaper needs at least two samples.");
+
+public:
+    InputShaper()
+        : config_{},
+          dt_(T{0}),
+          impulse_count_(0U),
+          amplitudes_{},
+          delays_{},
+          history_{},
+          head_(0U),
+          valid_(0U),
+          hold_(T{0})
+    {
+    }
+
+    /**
+     * @brief インパルス列の設定を変更する (遅延線は reset() するまで保持する)
+     * @param config 設定
+     */
+    void configure(const InputShaperConfig& config)
+    {
+        config_ = config;
+        if (dt_ > T{0}) {
+            design();
+        }
+    }
+
+    /**
+     * @brief 目標値を 1 サンプル進める
+     * @param input 目標値
+     * @param dt    サンプリング周期 [s]
+     * @return T 整形後の目標値 (整形しない設定なら input)
+     */
+    T update(T input, T dt)
+    {
+        if (dt <= T{0}) {
+            return input;
+        }
+        if (dt != dt_) {
+            dt_ = dt;
+            design();
+        }
+
+        head_           = next_index(head_);
+        history_[head_] = input;
+        if (valid_ < N) {
+            ++valid_;
+        }
+
+        if (impulse_count_ == 0U) {
+            return input;
+        }
+        T output = T{0};
+        for (std::size_t i = 0; i < impulse_count_; ++i) {
+            output += amplitudes_[i] * delayed(delays_[i]);
+        }
+        return output;
+    }
+
+    /**
+     * @brief 目標値が value で一定だった状態にリセットする (遅延線の書き換えはしない)
+     * @param value 目標値
+     */
+    void reset(T value = T{0})
+    {
+        valid_ = 0U;
+        hold_  = value;
+    }
+
+    /**
+     * @brief 整形するかを返す
+     * @return true 有効なインパルス列が設定されている
+     */
+    bool active() const
+    {
+        return impulse_count_ > 0U;
+    }
+
+private:
+    /// インパルスの最大数
+    static constexpr std::size_t MAX_IMPULSES = 3U;
+
+    /// EI の残留振動の許容値
+    static constexpr T EI_TOLERANCE = static_cast<T>(0.05);
+
+    /**
+     * @brief 設定と dt_ からインパルスの振幅と時刻 [サンプル] を計算する
+     */
+    void design()
+    {
+        impulse_count_ = 0U;
+
+        const T frequency = static_cast<T>(config_.frequency_hz);
+        const T damping   = static_cast<T>(config_.damping_ratio);
+        if (config_.type == InputShaperType::None || !(frequency > T{0}) || !(damping >= T{0}) ||
+            !(damping < T{1})) {
+            return;
+        }
+
+        // 減衰固有周期の半分 [サンプル] と、半周期で振動が減衰する比 K
+        constexpr T PI                     = static_cast<T>(3.14159265358979);
+        const T damped                     = std::sqrt(T{1} - damping * damping);
+        const T half_period                = T{0.5} / (frequency * damped * dt_);
+        const T decay                      = std::exp(-damping * PI / damped);
+        std::size_t count                  = MAX_IMPULSES;
+        std::array<T, MAX_IMPULSES> weight = {T{1}, T{2} * decay, decay * decay};
+        switch (config_.type) {
+            case InputShaperType::ZV:
+                count     = 2U;
+                weight[1] = decay;
+                break;
+
+            case InputShaperType::EI:
+                weight = {
+                    (T{1} + EI_TOLERANCE) / T{4},
+                    (T{1} - EI_TOLERANCE) / T{2},
+                    (T{1} + EI_TOLERANCE) / T{4},
+                };
+                break;
+
+            case InputShaperType::ZVD:
+            default:
+                break;
+        }
+
+        // 最後のインパルスの時刻と、その次のサンプル (補間用) が遅延線に収まらなければ整形しない
+        if (half_period * static_cast<T>(count - 1U) > static_cast<T>(N - 2U)) {
+            return;
+        }
+        T total = T{0};
+        for (std::size_t i = 0; i < count; ++i) {
+            total += weight[i];
+        }
+        for (std::size_t i = 0; i < count; ++i) {
+            amplitudes_[i] = weight[i] / total;
+            delays_[i]     = half_period * static_cast<T>(i);
+        }
+        impulse_count_ = count;
+    }
+
+    /**
+     * @brief delay サンプル前の目標値を線形補間で返す
+     * @param delay 遅れ [サンプル] (0 以上 N - 2 以下)
+     * @return T 目標値 (reset() より前のサンプルは reset() の値)
+     */
+    T delayed(T delay) const
+    {
+        const auto whole = static_cast<std::size_t>(delay);
+        const T fraction = delay - static_cast<T>(whole);
+        const T newer    = sample(whole);
+        const T older    = sample(whole + 1U);
+        return newer + (older - newer) * fraction;
+    }
+
+    /**
+     * @brief age サンプル前の目標値を返す
+     * @param age 何サンプル前か (N 未満)
+     * @return T 目標値
+     */
+    T sample(std::size_t age) const
+    {
+        if (age >= valid_) {
+            return hold_;
+        }
+        std::size_t index = head_ + N - age;
+        if (index >= N) {
+            index -= N;
+        }
+        return history_[index];
+    }
+
+    /**
+     * @brief 遅延線の次の書き込み位置を返す
+     * @param index 現在の位置
+     * @return std::size_t 次の位置
+     */
+    static std::size_t next_index(std::size_t index)
+    {
+        ++index;
+        if (index >= N) {
+            index = 0U;
+        }
+        return index;
+    }
+
+    InputShaperConfig config_;
+    T dt_;  ///< インパルスの時刻を計算したときの周期 [s]
+    std::size_t impulse_count_;
+    std::array<T, MAX_IMPULSES> amplitudes_;
+    std::array<T, MAX_IMPULSES> delays_;  ///< インパルスの時刻 [サンプル]
+    std::array<T, N> history_;            ///< 過去の目標値 (リングバッファ)
+    std::size_t head_;                    ///< 最新の目標値の位置
+    std::size_t valid_;                   ///< reset() 以降に書き込んだサンプル数 (N まで)
+    T hold_;                              ///< reset() 以前の目標値
+};
+
+}  // namespace gn10_motor
@@ -0,0 +1,156 @@
+/**
+ * @file jerk_limiter.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief 躍度制限付き加減速リミッター
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+
+namespace gn10_motor {
+
+/**
+ * @brief MotorController の加減速制限の拡張設定 (SetMotionLimits で受信し、フラッシュに保存する)
+ *        加速側の制限は従来どおり MotorConfig の accel_ratio で設定する
+ */
+struct MotionLimits {
+    float decel_ratio = 0.0f;  ///< 減速側の制限 (accel_ratio と同じ単位。0 で accel_ratio と同じ)
+    float jerk_per_s2 = 0.0f;  ///< 変化率の変化率の上限 [1/s^2] (0 で制限なし)
+};
+
+/**
+ * @brief 躍度制限付きの 2 次の加減速リミッター
+ *
+ * AccelerationLimiter は値の変化率だけを制限するため、ランプの始まりと終わりで変化率が
+ * 不連続になる。JerkLimiter は変化率の変化 (躍度) も制限し、ランプの角を丸める。
+ * 変化率の上限は |値| が増える向き (加速) と減る向き (減速) で別々に設定できる。
+ *
+ * 目標値に近づくと、躍度一定で変化率を 0 まで落としたときにちょうど目標値で止まる
+ * 変化率へ減速するため、目標値を通り過ぎない。1 周期の計算量は一定 (平方根 1 回)。
+ * 躍度制限を 0 にすると AccelerationLimiter と同じ 1 次の制限になる。
+ *
+ * @tparam T 浮動小数点型 (float, double)
+ */
+template <typename T>
+class JerkLimiter
+{
+    static_assert(std::is_floating_point_v<T>, "JerkLimiter only supports floating point types.");
+
+public:
+    /**
+     * @brief コンストラクタ
+     * @param max_acceleration |値| が増える向きの最大変化率 (単位/s) 絶対値で指定
+     * @param max_deceleration |値| が減る向きの最大変化率 (単位/s) 絶対値で指定
+     * @param max_jerk         変化率の最大変化率 (単位/s^2)。0 で躍度制限なし
+     * @param initial_value    初期値
+     */
+    JerkLimiter(T max_acceleration, T max_deceleration, T max_jerk, T initial_value = T{0})
+        : max_acceleration_(std::abs(max_acceleration)),
+          max_deceleration_(std::abs(max_deceleration)),
+          max_jerk_(std::abs(max_jerk)),
+          value_(initial_value),
+          rate_(T{0})
+    {
+    }
+
+    /**
+     * @brief 値を更新する
+     * @param target_value 目標値
+     * @param dt 経過時間 [s]
+     * @return T 制限された新しい値
+     */
+    T update(T target_value, T dt)
+    {
+        if (dt <= T{0}) {
+            return value_;
+        }
+
+        const T error = target_value - value_;
+
+        // 目標へ向かうと |値| が増えるなら加速、減るなら減速の制限を使う
+        T max_rate = max_acceleration_;
+        if ((error > T{0} && value_ < T{0}) || (error < T{0} && value_ > T{0})) {
+            max_rate = max_deceleration_;
+        }
+
+        if (max_jerk_ <= T{0}) {
+            // 1 次の制限 (AccelerationLimiter と同じ計算)
+            const T max_delta = max_rate * dt;
+            const T delta     = std::clamp(error, -max_delta, max_delta);
+            value_ += delta;
+            rate_ = delta / dt;
+            return value_;
+        }
+
+        // 躍度一定で 1 周期ずつ変化率を落とすと、変化率 r から止まるまでに
+        // r^2 / (2J) + r dt / 2 だけ進む。これが残りの誤差に等しくなる r を上限にする
+        const T jerk_step = max_jerk_ * dt;
+        const T half_step = jerk_step / T{2};
+        T desired_rate    = std::sqrt(half_step * half_step + T{2} * max_jerk_ * std::abs(error));
+        desired_rate      = std::min(desired_rate - half_step, max_rate);
+        if (error < T{0}) {
+            desired_rate = -desired_rate;
+        }
+        rate_ += std::clamp(desired_rate - rate_, -jerk_step, jerk_step);
+
+        // 目標値を通り過ぎる場合は目標値で止める
+        const T delta = rate_ * dt;
+        if ((error >= T{0} && delta >= error) || (error <= T{0} && delta <= error)) {
+            value_ = target_value;
+            rate_  = T{0};
+        } else {
+            value_ += delta;
+        }
+        return value_;
+    }
+
+    /**
+     * @brief 現在値を強制的にリセットする (変化率は 0 にする)
+     * 制御開始時や、外部要因で値が飛んだ場合に同期させるために使用
+     * @param value 新しい現在値
+     */
+    void reset(T value = T{0})
+    {
+        value_ = value;
+        rate_  = T{0};
+    }
+
+    /**
+     * @brief 制限値の更新
+     * @param max_acceleration |値| が増える向きの最大変化率 (単位/s)
+     * @param max_deceleration |値| が減る向きの最大変化率 (単位/s)
+     * @param max_jerk         変化率の最大変化率 (単位/s^2)。0 で躍度制限なし
+     */
+    void set_limits(T max_acceleration, T max_deceleration, T max_jerk)
+    {
+        max_acceleration_ = std::abs(max_acceleration);
+        max_deceleration_ = std::abs(max_deceleration);
+        max_jerk_         = std::abs(max_jerk);
+    }
+
+    /**
+     * @brief 現在の変化率を返す
+     * @return T 変化率 (単位/s)
+     */
+    T rate() const
+    {
+        return rate_;
+    }
+
+private:
+    T max_acceleration_;
+    T max_deceleration_;
+    T max_jerk_;
+    T value_;
+    T rate_;
+};
+
+}  // namespace gn10_motor
@@ -15,25 +15,54 @@
 
 #include "gn10_can/devices/motor_driver_server.hpp"
 #include "gn10_can/devices/motor_driver_types.hpp"
-#include "gn10_motor/acceleration_limiter.hpp"
+#include "gn10_motor/backlash.hpp"
+#include "gn10_motor/biquad.hpp"
+#include "gn10_motor/disturbance_observer.hpp"
+#include "gn10_motor/extension_server.hpp"
+#include "gn10_motor/feedback_scheduler.hpp"
+#include "gn10_motor/friction_map.hpp"
+#include "gn10_motor/homing.hpp"
 #include "gn10_motor/i_encoder.hpp"
 #include "gn10_motor/i_gate_driver.hpp"
+#include "gn10_motor/input_shaper.hpp"
+#include "gn10_motor/jerk_limiter.hpp"
+#include "gn10_motor/parameter_store.hpp"
 #include "gn10_motor/pid.hpp"
+#include "gn10_motor/position_limits.hpp"
+#include "gn10_motor/timeout_policy.hpp"
+#include "gn10_motor/tracking_observer.hpp"
 
 namespace gn10_motor {
 
+/**
+ * @brief リミットスイッチが入ったエッジで記録した状態と位置
+ */
+struct LimitSwitchEdge {
+    uint8_t state      = 0U;    ///< エッジ直後のリミットスイッチ状態 (ビットマップ)
+    float position_rad = 0.0f;  ///< エッジ時点の積算角度 [rad] (原点復帰後は原点からの角度)
+};
+
 /**
  * @brief DCモーター制御クラス
  *
  * IGateDriver / IEncoder / MotorDriverServer をDIとして受け取り、
- * PID制御 + 加速度制限 + リミットスイッチ処理を組み合わせてモーターを制御する。
+ * PID制御 + 加減速制限 + リミットスイッチ処理を組み合わせてモーターを制御する。
  *
  * CAN通信は MotorDriverServer を経由し、設定・目標値・ゲインを受け取り
- * エンコーダのフィードバック値を送り返す。
+ * エンコーダのフィードバック値を送り返す。gn10_can にない設定は ExtensionServer から受け取る。
  *
- * CAN受信割り込み  ： CANBus::update() (MotorControllerは不要)
+ * CAN受信割り込み  ： CANBus::update() / ExtensionServer::on_receive() (MotorControllerは不要)
  *
  * タイマー割り込み ： MotorController::update(dt_s, limit_switch_state)
+ *
+ * リミットスイッチのエッジ割り込み ： MotorController::on_limit_switch_edge() (任意)
+ *
+ * StartHoming を受信すると原点復帰を行う。LIM1 へ向かって一定速度で位置目標を動かし、
+ * on_limit_switch_edge() で記録したエッジの位置を原点にしてから、逆向きに退避して停止する。
+ *
+ * CalibrateFriction を受信すると、位置目標を一定速度で正転・逆転の順に動かし、出力したデューティを
+ * 位置ごとに平均して摩擦のマップ (FrictionMap) を作る。SetFriction で有効にすると、
+ * マップから求めたデューティを PID の出力に足す。
  */
 class MotorController
 {
@@ -43,11 +72,28 @@ public:
      * @param driver   ゲートドライバ実装への参照
      * @param encoder  エンコーダ実装への参照
      * @param can_server MotorDriverServer への参照
+     * @param extension_server ExtensionServer への参照
+     * @param parameter_store  フラッシュのパラメータ保存先
+     * @param absolute_encoder EncoderType::Absolute で使うエンコーダ (未搭載のボードは nullptr)
      */
     MotorController(
-        IGateDriver& driver, IEncoder& encoder, gn10_can::devices::MotorDriverServer& can_server
+        IGateDriver& driver,
+        IEncoder& encoder,
+        gn10_can::devices::MotorDriverServer& can_server,
+        ExtensionServer& extension_server,
+        ParameterStore& parameter_store,
+        IEncoder* absolute_encoder = nullptr
     );
 
+    /**
+     * @brief フラッシュに保存された設定・ゲインを適用する
+     *        成功すればホストの init パケットを待たずに制御を開始する。
+     *        その後ホストから受信した init / ゲインは一時的な上書きとして扱い、
+     *        SaveParameters を受信するまでフラッシュには書き込まない。
+     * @return true 有効なパラメータがあり、適用した
+     */
+    bool load_parameters();
+
     /**
      * @brief 制御ループを1ステップ実行する
      *
@@ -55,23 +101,51 @@ public:
      * @param limit_switch_state リミットスイッチ状態 (ビットマップ、bit0=SW1, bit1=SW2)
      *
      * @details タイマー割り込みから毎制御周期呼ぶこと。内部では以下を順番に処理する。
-     * 1. CAN から設定/ゲイン/目標値を polling
-     * 2. エンコーダ読み取り
-     * 3. PID (または オープンループ) 演算
-     * 4. 加速度制限
-     * 5. リミットスイッチによる出力制限
+     * 1. CAN から設定/ゲイン/目標値を polling (同期モードでは Sync 受信時に目標値を適用)
+     * 2. エンコーダ読み取り (フィードバック値は biquad フィルタを通す)、外乱の推定
+     * 3. PID (または オープンループ) 演算。目標値の受信途絶中は TimeoutPolicy に従って停止する
+     *    (目標値は InputShaper で整形する。原点復帰中は整形せずに原点復帰の位置目標を使う)
+     *    摩擦の校正中は校正の位置目標を使い、出力したデューティを位置ごとに記録する
+     * 4. 加減速・躍度制限
+     * 5. リミットスイッチ・可動範囲 (PositionLimits) による出力制限
      * 6. ゲートドライバへ出力
-     * 7. フィードバック値を CAN 送信
+     * 7. フィードバック値 (と外乱の推定値) を CAN 送信 (FeedbackPolicy に従い間引く)
      */
     void update(float dt_s, uint8_t limit_switch_state = 0);
 
+    /**
+     * @brief リミットスイッチが入ったエッジで呼ぶ (EXTI / 入力キャプチャ割り込みから)
+     *
+     * 停止方向に出力中なら次の制御周期を待たずに出力を 0 にし、エッジ時点の状態と位置を記録する。
+     * 記録した状態は次の update() で limit_switch_state に合成するため、
+     * 制御周期の間に入って離れたスイッチも 1 周期は出力を止める。
+     * 位置は取得されるまで最初のエッジのものを保持する (チャタリングで上書きしない)。
+     * update() の途中で割り込まないよう、制御タイマーと同じ優先度の割り込みから呼ぶこと。
+     *
+     * @param limit_switch_state エッジ直後のリミットスイッチ状態 (ビットマップ)
+     * @param pending_count      前回の read_and_reset_count() からエッジまでの
+     *                           インクリメンタルエンコーダのカウント
+     *                           (入力キャプチャの値、またはカウンタをリセットせずに読んだ値)
+     */
+    void on_limit_switch_edge(uint8_t limit_switch_state, int16_t pending_count);
+
+    /**
+     * @brief 記録したリミットスイッチのエッジを取得する (原点復帰中は MotorController が取得する)
+     * @param edge 記録の格納先
+     * @return true 前回取得以降にエッジを記録した
+     */
+    bool get_limit_switch_edge(LimitSwitchEdge& edge);
+
     /**
      * @brief モーターを即時停止し、制御器をリセットする
+     *        目標値の受信途絶によるタイムアウト状態は解除しない
      */
     void stop();
 
     /**
      * @brief 制御器の内部状態をリセットする (設定・初期化状態は維持)
+     *        エンコーダの積算角度を 0 に戻すため、原点復帰で設定した原点も破棄し、
+     *        原点復帰中なら中止する
      */
     void reset();
 
@@ -93,29 +167,127 @@ public:
         return target_;
     }
 
+    /**
+     * @brief 拡張フィードバックで通知する補助計測値を設定する
+     *        メインループから呼んでよい (値ごとの 32 bit の書き込みのため、
+     *        制御周期の割り込みとの間で 1 つの値が壊れることはない)
+     * @param current_a        モーター電流 [A] (未計測なら NaN)
+     * @param temperature_degc 基板温度 [degC] (未計測なら NaN)
+     */
+    void set_auxiliary_measurements(float current_a, float temperature_degc)
+    {
+        current_a_        = current_a;
+        temperature_degc_ = temperature_degc;
+    }
+
 private:
     // --- DI で注入されるハードウェア依存オブジェクト ---
     IGateDriver& driver_;
     IEncoder& encoder_;
     gn10_can::devices::MotorDriverServer& can_server_;
+    ExtensionServer& extension_server_;
+    ParameterStore& parameter_store_;
+    IEncoder* absolute_encoder_;  ///< アブソリュートエンコーダ (未搭載なら nullptr)
 
     // --- 制御アルゴリズム ---
     PID<float> pid_;
-    AccelerationLimiter<float> accel_limiter_;
+    JerkLimiter<float> accel_limiter_;
+    TrackingObserver<float> observer_;                     ///< 位置・速度の推定 (SetObserver)
+    BiquadCascade<float, BIQUAD_STAGES> feedback_filter_;  ///< フィードバック値のフィルタ
+    BiquadCascade<float, BIQUAD_STAGES> output_filter_;    ///< PID の出力のフィルタ
+    DisturbanceObserver<float> disturbance_observer_;      ///< 負荷の推定 (SetDisturbance)
+    InputShaper<float, SHAPER_LENGTH> input_shaper_;       ///< 目標値の入力整形
+    BacklashCompensator<float> backlash_compensator_;      ///< ギアの遊びの補償 (位置制御)
+    FrictionCalibrator friction_calibrator_;               ///< 摩擦のマップの校正
+    FeedbackScheduler feedback_scheduler_;
 
     // --- 状態 ---
-    float target_;          ///< CAN から受け取った目標値
-    float feedback_value_;  ///< エンコーダから計算したフィードバック値 [rad/s or rad]
+    float target_;                ///< CAN から受け取った目標値
+    float staged_target_;         ///< 同期モードで Sync 受信まで保留している目標値
+    bool target_staged_;          ///< staged_target_ が未適用なら true
+    float feedback_value_;        ///< エンコーダから計算したフィードバック値 [rad/s or rad]
+    float position_rad_;          ///< 原点からの積算角度 [rad] (拡張フィードバック用)
+    float velocity_rad_s_;        ///< 角速度 [rad/s] (拡張フィードバック用)
+    float duty_;                  ///< 最後に出力したデューティ [-1.0, 1.0]
+    float current_a_;             ///< モーター電流 [A] (未計測なら NaN)
+    float temperature_degc_;      ///< 基板温度 [degC] (未計測なら NaN)
+    extension::FaultCode fault_;  ///< 拡張フィードバックで通知する異常コード
     bool initialized_;  ///< init パケット受信後に true になる
 
+    // --- リミットスイッチのエッジ (on_limit_switch_edge() で記録) ---
+    LimitSwitchEdge limit_edge_;         ///< 最後に記録したエッジ
+    volatile bool limit_edge_latched_;   ///< limit_edge_ が未取得なら true
+    volatile uint8_t limit_edge_state_;  ///< 次の update() で合成するスイッチ状態
+
+    // --- 原点復帰 (StartHoming) ---
+
+    /**
+     * @brief 原点復帰の段階
+     */
+    enum class HomingPhase : uint8_t {
+        None,        ///< 原点復帰していない
+        Releasing,   ///< 開始時に LIM1 が入っていたため、離れるまで逆向きに動いている
+        Seeking,     ///< LIM1 へ向かって動き、エッジを待っている
+        BackingOff,  ///< 原点を設定し、退避位置へ戻っている
+    };
+
+    HomingConfig homing_;
+    HomingPhase homing_phase_;
+    float homing_target_;        ///< 原点復帰中の位置目標 [rad] (target_ の代わりに使う)
+    float position_offset_rad_;  ///< エンコーダの積算角度からみた原点の位置 [rad]
+    static constexpr uint8_t HOMING_SWITCH_MASK = 0b0001U;  ///< 原点に使うスイッチ (LIM1)
+
+    // --- 摩擦の校正 (CalibrateFriction) ---
+
+    /**
+     * @brief 摩擦の校正の段階
+     */
+    enum class CalibrationPhase : uint8_t {
+        None,      ///< 校正していない
+        Forward,   ///< 正転でデューティを記録している
+        Backward,  ///< 逆転でデューティを記録している
+    };
+
+    FrictionCalibration calibration_;
+    CalibrationPhase calibration_phase_;
+    float calibration_target_;  ///< 校正中の位置目標 [rad] (target_ の代わりに使う)
+    float calibration_travel_;  ///< 今の向きに動き始めてからの移動量 [rad]
+    float friction_target_;     ///< 前の周期の位置目標 [rad] (フィードフォワードの向きに使う)
+
+    /// 向きを変えてから記録を始めるまでの移動量 [rad] (1/8 回転。加速と積分の追従を待つ)
+    static constexpr float CALIBRATION_SETTLE_RAD = 0.785398163f;
+
     // --- 設定 ---
     gn10_can::devices::MotorConfig config_;
     std::array<float, static_cast<std::size_t>(gn10_can::devices::GainType::Count)> gains_;
+    MotionLimits motion_limits_;      ///< 減速側の制限・躍度制限 (SetMotionLimits)
+    TimeoutPolicy timeout_policy_;    ///< 目標値の受信途絶時の停止方法 (SetTimeoutPolicy)
+    PositionLimits position_limits_;  ///< 位置制御の可動範囲 (SetPositionLimit)
+    ObserverConfig observer_config_;  ///< 追従オブザーバの設定 (SetObserver)
+    BiquadFilters biquad_filters_;    ///< biquad フィルタの設定 (SetBiquad)
+    DisturbanceConfig disturbance_;   ///< 外乱オブザーバの設定 (SetDisturbance)
+    InputShaperConfig shaper_;        ///< 入力整形の設定 (SetInputShaper)
+    BacklashConfig backlash_;         ///< バックラッシ補償の設定 (SetBacklash)
+    FrictionMap friction_map_;        ///< 摩擦のマップ (CalibrateFriction / SetFriction)
 
     // --- タイムアウト管理 ---
+
+    /**
+     * @brief タイムアウト後の停止処理の段階
+     */
+    enum class TimeoutPhase : uint8_t {
+        None,     ///< タイムアウトしていない
+        Ramping,  ///< 出力を 0 まで減速中
+        Settled,  ///< 減速を終え、TimeoutAction の動作中
+    };
+
     uint32_t no_target_count_;
+    TimeoutPhase timeout_phase_;
     static constexpr uint32_t NO_TARGET_TIMEOUT_CYCLES = 100;  ///< この周期数だけ更新がなければ停止
 
+    // --- 時刻 ---
+    uint64_t sample_time_us_;  ///< エンコーダのサンプリング時刻 (同期済みボード時刻) [us]
+
     // --- 内部処理 ---
 
     /**
@@ -124,10 +296,93 @@ private:
     void poll_can();
 
     /**
-     * @brief 設定変更時に PIDConfig と AccelerationLimiter を再構築する
+     * @brief ExtensionServer で受信したパラメータ操作を実行し、結果を返信する
+     *        保存・消去中はフラッシュ操作で数十 ms 停止するため、先にモーターを止める
+     */
+    void handle_parameter_action();
+
+    /**
+     * @brief 設定変更時に PID・JerkLimiter・オブザーバ・フィルタ・入力整形・バックラッシ補償の
+     *        設定を再構築する
      */
     void apply_config_to_controllers();
 
+    /**
+     * @brief 目標値の入力整形、バックラッシ補償、PID (またはオープンループ) 演算、
+     *        外乱・摩擦の補償、出力フィルタ、max_duty_ratio の制限、加減速制限を行う
+     * @param dt_s 制御周期 [s]
+     * @return float 出力値 [-1.0, 1.0]
+     */
+    float compute_duty(float dt_s);
+
+    /**
+     * @brief タイムアウト中の出力を計算する
+     *        Stop 以外は JerkLimiter で出力を 0 まで減速してから TimeoutAction の動作に移る
+     * @param dt_s 制御周期 [s]
+     * @return float 出力値 [-1.0, 1.0]
+     */
+    float update_timeout(float dt_s);
+
+    /**
+     * @brief 減速を終えたときに TimeoutAction の動作を開始する
+     */
+    void settle_timeout();
+
+    /**
+     * @brief タイムアウト状態を解除し、通常の制御に戻す (タイムアウト中でなければ何もしない)
+     */
+    void resume_from_timeout();
+
+    /**
+     * @brief 原点復帰を開始する (speed_rad_s = 0 なら中止する)
+     *        init 受信前、または IncrementalTotal 以外では開始せず Rejected を返信する
+     * @param config 受信した設定
+     */
+    void start_homing(const HomingConfig& config);
+
+    /**
+     * @brief 原点復帰の位置目標を 1 周期分進め、target_ に設定する
+     * @param dt_s               制御周期 [s]
+     * @param limit_switch_state リミットスイッチ状態 (ビットマップ)
+     */
+    void update_homing(float dt_s, uint8_t limit_switch_state);
+
+    /**
+     * @brief 原点復帰を終了し、結果を返信する (原点復帰中でなければ何もしない)
+     * @param status 結果
+     */
+    void finish_homing(extension::HomingStatus status);
+
+    /**
+     * @brief 摩擦の校正を開始する (speed_rad_s = 0 なら中止する)
+     *        init 受信前、位置制御でない、PID を使わない、原点復帰中のときは
+     *        開始せず Rejected を返信する
+     * @param config 受信した設定
+     */
+    void start_friction_calibration(const FrictionCalibration& config);
+
+    /**
+     * @brief 前の周期に出力したデューティを記録し、校正の位置目標を 1 周期分進めて
+     *        target_ に設定する
+     * @param dt_s 制御周期 [s]
+     */
+    void update_friction_calibration(float dt_s);
+
+    /**
+     * @brief 摩擦の校正を終了し、結果を返信する (校正中でなければ何もしない)
+     *        正転の記録をマップに仮置きした後で失敗・中止したら、マップを未校正に戻す
+     * @param status 結果
+     */
+    void finish_friction_calibration(extension::FrictionStatus status);
+
+    /**
+     * @brief 摩擦のフィードフォワードに使う回転方向を返す
+     *        速度制御は目標速度の向き、位置制御は前の周期からの位置目標の移動方向
+     * @param target 目標値 (速度制御なら目標速度 [rad/s])
+     * @return float +1: 正転, -1: 逆転, 0: 停止中
+     */
+    float friction_direction(float target);
+
     /**
      * @brief リミットスイッチによる出力制限
      * @param duty           制限前の出力値 [-1.0, 1.0]
@@ -136,12 +391,48 @@ private:
      */
     float apply_limit_switch(float duty, uint8_t limit_sw_state) const;
 
+    /**
+     * @brief フィードバック値が位置かを返す
+     * @return true IncrementalTotal、またはアブソリュートエンコーダを接続した Absolute のとき
+     */
+    bool position_feedback() const;
+
+    /**
+     * @brief 可動範囲 (PositionLimits) を適用するかを返す
+     * @return true 位置で制御していて (position_feedback())、原点復帰中でなく、下限 <= 上限のとき
+     */
+    bool position_limits_active() const;
+
+    /**
+     * @brief 可動範囲による出力制限
+     *        現在の速度から decel_rad_s2 で止まるまでの距離が範囲の端までの距離以上なら、
+     *        範囲の外へ向かう出力を 0 にする。範囲の外にいれば FaultCode::PositionLimit を通知する
+     * @param duty 制限前の出力値 [-1.0, 1.0]
+     * @return float 制限後の出力値 [-1.0, 1.0]
+     */
+    float apply_position_limits(float duty);
+
+    /**
+     * @brief フィードバックを送信する
+     *        CAN FD が有効なら拡張フィードバック、無効なら MotorDriverServer で送る
+     * @param limit_switch_state リミットスイッチ状態 (ビットマップ)
+     */
+    void send_feedback(uint8_t limit_switch_state);
+
+    /**
+     * @brief エンコーダタイプに応じて読み取るエンコーダを返す
+     * @return IEncoder& Absolute かつ搭載済みならアブソリュートエンコーダ、それ以外は encoder_
+     */
+    IEncoder& active_encoder();
+
     /**
      * @brief エンコーダタイプに応じてフィードバック値を更新する
+     *        追従オブザーバが有効なら、速度は推定速度、位置はカウント間を補間した推定位置を使う
      * @param count read_and_reset_count() の戻り値
      * @param dt_s  制御周期 [s]
      * @return float フィードバック値 (速度 [rad/s] または 積算角度 [rad])
-     *               Absolute タイプは未対応のため 0.0f を返し出力を停止する
+     *               アブソリュートエンコーダ未搭載のボードで Absolute が設定されたら
+     *               0.0f を返し出力を停止する
      */
     float compute_feedback(int16_t count, float dt_s);
 };
@@ -0,0 +1,131 @@
+/**
+ * @file parameter_store.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief フラッシュへのパラメータ保存 (ウェアレベリング・CRC・バージョン付き)
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+#include "gn10_can/devices/motor_driver_types.hpp"
+#include "gn10_motor/backlash.hpp"
+#include "gn10_motor/biquad.hpp"
+#include "gn10_motor/disturbance_observer.hpp"
+#include "gn10_motor/feedback_scheduler.hpp"
+#include "gn10_motor/friction_map.hpp"
+#include "gn10_motor/i_parameter_flash.hpp"
+#include "gn10_motor/input_shaper.hpp"
+#include "gn10_motor/jerk_limiter.hpp"
+#include "gn10_motor/position_limits.hpp"
+#include "gn10_motor/timeout_policy.hpp"
+#include "gn10_motor/tracking_observer.hpp"
+
+namespace gn10_motor {
+
+/**
+ * @brief フラッシュに保存するパラメータ
+ *        メンバを追加・変更したら PARAMETER_VERSION を上げること
+ */
+struct StoredParameters {
+    gn10_can::devices::MotorConfig config;
+    std::array<float, static_cast<std::size_t>(gn10_can::devices::GainType::Count)> gains{};
+    FeedbackPolicy feedback_policy;
+    MotionLimits motion_limits;
+    TimeoutPolicy timeout_policy;
+    PositionLimits position_limits;
+    ObserverConfig observer;
+    BiquadFilters biquad_filters;
+    DisturbanceConfig disturbance;
+    InputShaperConfig input_shaper;
+    BacklashConfig backlash;
+    FrictionMap friction_map;
+};
+
+static_assert(
+    std::is_trivially_copyable_v<StoredParameters>,
+    "StoredParameters is written to flash as raw bytes."
+);
+
+/**
+ * @brief フラッシュへのパラメータ保存クラス
+ *
+ * 保存のたびにレコード (ヘッダ + StoredParameters) をページ末尾へ追記し、
+ * 読み出し時はシーケンス番号が最大で CRC が正しいレコードを採用する。
+ * ページが一杯になったら次のページを消去して書き込むため、消去回数は
+ * (ページサイズ / レコードサイズ) 回の保存につき 1 回になり、消去中に電源が
+ * 落ちても直前のページのレコードが残る。
+ *
+ * ヘッダのバージョンまたはペイロード長が一致しないレコードは無視する。
+ */
+class ParameterStore
+{
+public:
+    /// レコード形式のバージョン (StoredParameters を変更したら上げる)
+    static constexpr uint16_t PARAMETER_VERSION = 10U;
+
+    /**
+     * @brief コンストラクタ
+     * @param flash 保存先のフラッシュ領域
+     */
+    explicit ParameterStore(IParameterFlash& flash);
+
+    /**
+     * @brief 最新の有効なレコードを読み出す
+     * @param params 読み出し先
+     * @return true 有効なレコードがあった
+     */
+    bool load(StoredParameters& params);
+
+    /**
+     * @brief パラメータを保存する (ページ消去を伴う場合は数十 ms かかる)
+     * @param params 保存するパラメータ
+     * @return true 書き込みと読み戻しの照合に成功した
+     */
+    bool save(const StoredParameters& params);
+
+    /**
+     * @brief 全ページを消去し、保存済みパラメータを無効にする
+     * @return true 消去に成功した
+     */
+    bool clear();
+
+private:
+    /// レコードヘッダ
+    struct RecordHeader {
+        uint32_t magic;
+        uint16_t version;
+        uint16_t length;
+        uint32_t sequence;
+        uint32_t crc;
+    };
+
+    /**
+     * @brief 全ページを走査し、最新レコードの位置と次の書き込み位置を求める
+     */
+    void scan();
+
+    /**
+     * @brief レコードが有効か検証する
+     * @param record レコード先頭
+     * @return true マジック・バージョン・長さ・CRC がすべて一致した
+     */
+    static bool is_valid(const uint8_t* record);
+
+    IParameterFlash& flash_;
+    bool scanned_;
+    uint8_t active_page_;     ///< 書き込み中のページ
+    uint32_t next_offset_;    ///< active_page_ 内の次の書き込み位置 [byte]
+    uint32_t sequence_;       ///< 最新レコードのシーケンス番号 (0 はレコードなし)
+    uint8_t latest_page_;     ///< 最新レコードのページ
+    uint32_t latest_offset_;  ///< 最新レコードのオフセット [byte]
+};
+
+}  // namespace gn10_motor
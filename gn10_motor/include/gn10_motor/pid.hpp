@@ -43,7 +43,10 @@ public:
 
         T p_term = config_.kp * error;
 
-        integral_ += error * dt;
+        // 積分の保持中は蓄積しない (バックラッシの遊びの中など)
+        if (!integral_held_) {
+            integral_ += error * dt;
+        }
 
         // 積分蓄積値を制限
         integral_ = std::clamp(integral_, -config_.integral_limit, config_.integral_limit);
@@ -76,6 +79,15 @@ public:
         previous_measurement_ = current_measurement;
     }
 
+    /**
+     * @brief 積分項の蓄積を止める・再開する (蓄積済みの値は保持する)
+     * @param held true で蓄積を止める
+     */
+    void hold_integral(bool held)
+    {
+        integral_held_ = held;
+    }
+
     void set_config(const PIDConfig<T>& config)
     {
         config_   = config;
@@ -97,6 +109,7 @@ private:
     PIDConfig<T> config_;
     T integral_             = T{0};
     T previous_measurement_ = T{0};
+    bool integral_held_     = false;
 };
 
 }  // namespace gn10_motor
\ No newline at end of file
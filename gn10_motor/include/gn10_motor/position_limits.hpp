@@ -0,0 +1,31 @@
+/**
+ * @file position_limits.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief 位置制御のソフトウェア可動範囲
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#pragma once
+
+#include <limits>
+
+namespace gn10_motor {
+
+/**
+ * @brief 位置制御の可動範囲 (SetPositionLimit で受信し、フラッシュに保存する)
+ *
+ * 位置目標を [min_rad, max_rad] に制限し、現在の速度で decel_rad_s2 の減速をしても範囲内に
+ * 止まれなくなったら、範囲の外へ向かう出力を止めて (ショートブレーキで) 減速させる。
+ * 範囲を超えたら FaultCode::PositionLimit を通知する。
+ */
+struct PositionLimits {
+    float min_rad      = -std::numeric_limits<float>::infinity();  ///< 下限 [rad] (-inf で制限なし)
+    float max_rad      = std::numeric_limits<float>::infinity();   ///< 上限 [rad] (+inf で制限なし)
+    float decel_rad_s2 = 0.0f;  ///< 制動距離の計算に使う減速度 [rad/s^2] (0 で手前から減速しない)
+};
+
+}  // namespace gn10_motor
@@ -0,0 +1,38 @@
+/**
+ * @file timeout_policy.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief 目標値の受信途絶時の停止方法
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#pragma once
+
+#include <cstdint>
+
+namespace gn10_motor {
+
+/**
+ * @brief 目標値の受信途絶タイムアウト後の動作
+ *
+ * Stop 以外は、出力デューティを JerkLimiter で 0 まで減速してから各動作に移る。
+ */
+enum class TimeoutAction : uint8_t {
+    Stop  = 0,  ///< 即時に出力 0 (従来動作。減速しない)
+    Hold  = 1,  ///< 減速後、位置制御は停止位置、速度制御は速度 0 を PID で保持する
+    Brake = 2,  ///< 減速後、出力 0 でショートブレーキ (IGateDriver::set_brake(true))
+    Coast = 3,  ///< 減速後、出力 0 でブレーキを解除して惰性で止める
+};
+
+/**
+ * @brief タイムアウト時の停止方法
+ */
+struct TimeoutPolicy {
+    TimeoutAction action = TimeoutAction::Stop;
+    float decel_ratio    = 0.0f;  ///< 減速の変化率 (accel_ratio と同じ単位。0 で通常の減速側の制限)
+};
+
+}  // namespace gn10_motor
@@ -0,0 +1,206 @@
+/**
+ * @file tracking_observer.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief エンコーダの位置から位置・速度・加速度を推定する追従オブザーバ
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#pragma once
+
+#include <cmath>
+#include <type_traits>
+
+namespace gn10_motor {
+
+/**
+ * @brief 速度・位置の推定の設定 (SetObserver で受信し、フラッシュに保存する)
+ */
+struct ObserverConfig {
+    float bandwidth_rad_s   = 0.0f;  ///< 推定の帯域 [rad/s] (0 でオブザーバを使わず差分で求める)
+    float input_gain_rad_s2 = 0.0f;  ///< デューティ 1.0 あたりの角加速度 [rad/s^2] (0 で入力なし)
+};
+
+/**
+ * @brief 等加速度モデルの定常カルマンフィルタ (α-β-γ フィルタ) による追従オブザーバ
+ *
+ * 位置・速度・加速度を 1 周期分予測し、計測位置との差 (イノベーション) に固定ゲインを掛けて
+ * 補正する。ゲインは推定誤差の 3 つの極を z = exp(-bandwidth × dt) に重ねて決める
+ * (PLL 型の追従ループと同じ形で、等加速度の運動には定常偏差なく追従する)。
+ * 帯域は MAX_BANDWIDTH_DT / dt で頭打ちにする (それ以上は量子化ノイズを増やすだけになる)。
+ * カウント差分を dt で割る速度より量子化ノイズが小さく、帯域を上げれば遅れも小さくなる。
+ *
+ * 状態は計測位置との差として持ち、計測値は前回からの差分で受け取る。
+ * 積算角度が大きくなっても float の桁落ちで推定がずれない。
+ *
+ * 入力ゲインを設定すると、出力 (デューティ) × 入力ゲインをモデルの角加速度として予測に加える。
+ * 加速度の推定値はモデルで説明できない分 (負荷・摩擦) になる。
+ *
+ * ゲインは set_bandwidth() と dt の変化時だけ計算するため、1 周期の計算量は乗算 10 回程度。
+ *
+ * @tparam T 浮動小数点型 (float, double)
+ */
+template <typename T>
+class TrackingObserver
+{
+    static_assert(
+        std::is_floating_point_v<T>, "TrackingObserver only supports floating point types."
+    );
+
+public:
+    /**
+     * @brief コンストラクタ
+     * @param bandwidth_rad_s  推定の帯域 [rad/s] (0 で無効)
+     * @param input_gain_rad_s2 入力 1.0 あたりの角加速度 [rad/s^2]
+     */
+    explicit TrackingObserver(T bandwidth_rad_s = T{0}, T input_gain_rad_s2 = T{0})
+        : bandwidth_(T{0}),
+          input_gain_(input_gain_rad_s2),
+          dt_(T{0}),
+          gain_position_(T{0}),
+          gain_velocity_(T{0}),
+          gain_acceleration_(T{0}),
+          position_error_(T{0}),
+          velocity_(T{0}),
+          acceleration_(T{0})
+    {
+        set_bandwidth(bandwidth_rad_s);
+    }
+
+    /**
+     * @brief 1 周期分の推定を行う
+     * @param measured_delta 前回からの計測位置の変化
+     * @param dt             経過時間 [s]
+     * @param input          モデルの入力 (前の周期に出力したデューティ)
+     * @return T 推定速度
+     */
+    T update(T measured_delta, T dt, T input = T{0})
+    {
+        if (dt <= T{0} || !enabled()) {
+            return velocity_;
+        }
+        if (dt != dt_) {
+            dt_ = dt;
+            update_gains();
+        }
+
+        // 予測 (推定位置 - 計測位置 は、計測位置が進んだ分だけ減る)
+        const T model_acceleration = acceleration_ + input_gain_ * input;
+        position_error_ += (velocity_ + model_acceleration * dt * T{0.5}) * dt - measured_delta;
+        velocity_ += model_acceleration * dt;
+
+        // 補正 (イノベーション = 計測位置 - 予測位置)
+        const T innovation = -position_error_;
+        position_error_ += gain_position_ * innovation;
+        velocity_ += gain_velocity_ * innovation;
+        acceleration_ += gain_acceleration_ * innovation;
+        return velocity_;
+    }
+
+    /**
+     * @brief 推定値を計測値に合わせてリセットする
+     *        制御開始時や、エンコーダの切り替えで計測値が飛んだときに使用
+     * @param velocity 新しい推定速度
+     */
+    void reset(T velocity = T{0})
+    {
+        position_error_ = T{0};
+        velocity_       = velocity;
+        acceleration_   = T{0};
+    }
+
+    /**
+     * @brief 推定の帯域を設定する (0 以下で無効、MAX_BANDWIDTH_DT / dt を超える分は頭打ち)
+     * @param bandwidth_rad_s 帯域 [rad/s]
+     */
+    void set_bandwidth(T bandwidth_rad_s)
+    {
+        bandwidth_ = T{0};
+        if (bandwidth_rad_s > T{0}) {
+            bandwidth_ = bandwidth_rad_s;
+        }
+        if (dt_ > T{0}) {
+            update_gains();
+        }
+    }
+
+    /**
+     * @brief モデルの入力ゲインを設定する
+     * @param input_gain_rad_s2 入力 1.0 あたりの角加速度 [rad/s^2] (0 で入力を使わない)
+     */
+    void set_input_gain(T input_gain_rad_s2)
+    {
+        input_gain_ = input_gain_rad_s2;
+    }
+
+    /**
+     * @brief 推定を行うかを返す
+     * @return true 帯域が設定されている
+     */
+    bool enabled() const
+    {
+        return bandwidth_ > T{0};
+    }
+
+    /**
+     * @brief 推定位置と計測位置の差を返す (推定位置 = 計測位置 + この値)
+     * @return T 位置の差
+     */
+    T position_error() const
+    {
+        return position_error_;
+    }
+
+    /**
+     * @brief 推定速度を返す
+     * @return T 速度 (位置の単位/s)
+     */
+    T velocity() const
+    {
+        return velocity_;
+    }
+
+    /**
+     * @brief 推定加速度を返す (入力ゲインを設定していればモデルで説明できない分)
+     * @return T 加速度 (位置の単位/s^2)
+     */
+    T acceleration() const
+    {
+        return acceleration_;
+    }
+
+    /// 帯域 × 周期の上限 (1 ms 周期で 500 rad/s)
+    static constexpr T MAX_BANDWIDTH_DT = T{0.5};
+
+private:
+    /**
+     * @brief 推定誤差の極がすべて r = exp(-bandwidth × dt) になるゲインを計算する
+     *
+     * s = 1 - r として、誤差の遷移行列 (I - K H) F の特性多項式が (z - r)^3 になるように
+     *   k1 = 1 - r^3 = 3s - 3s^2 + s^3, k2 = (3s^2 - 1.5s^3) / dt, k3 = s^3 / dt^2
+     * とする。
+     */
+    void update_gains()
+    {
+        const T bandwidth  = std::fmin(bandwidth_, MAX_BANDWIDTH_DT / dt_);
+        const T s          = T{1} - std::exp(-bandwidth * dt_);
+        gain_position_     = T{3} * s - T{3} * s * s + s * s * s;
+        gain_velocity_     = (T{3} * s * s - T{1.5} * s * s * s) / dt_;
+        gain_acceleration_ = s * s * s / (dt_ * dt_);
+    }
+
+    T bandwidth_;
+    T input_gain_;
+    T dt_;  ///< ゲインを計算したときの周期 [s]
+    T gain_position_;
+    T gain_velocity_;
+    T gain_acceleration_;
+    T position_error_;  ///< 推定位置 - 計測位置
+    T velocity_;
+    T acceleration_;
+};
+
+}  // namespace gn10_motor
@@ -0,0 +1,773 @@
+/**
+ * @file extension_server.cpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief 拡張コマンドの受信・保持クラスの実装
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "gn10_motor/extension_server.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "gn10_motor/critical_section.hpp"
+
+namespace gn10_motor {
+
+// SetFeedbackPolicy のペイロード長 (command:1 + mode:1 + period_cycles:2 + delta_threshold:4)
+static constexpr uint8_t FEEDBACK_POLICY_LENGTH = 8;
+
+// SetFrameFormat のペイロード長 (command:1 + fd_enabled:1)
+static constexpr uint8_t FRAME_FORMAT_LENGTH = 2;
+
+// SetGains のペイロード長 (command:1 + kp/ki/kd:4x3)
+static constexpr uint8_t GAINS_LENGTH = 13;
+
+// SetSyncMode のペイロード長 (command:1 + latch_enabled:1 + phase_align:1)
+static constexpr uint8_t SYNC_MODE_LENGTH = 3;
+
+// TimeSyncRequest のペイロード長 (command:1 + seq:1)
+static constexpr uint8_t TIME_SYNC_REQUEST_LENGTH = 2;
+
+// SetClock のペイロード長 (command:1 + reserved:1 + time_us:6)
+static constexpr uint8_t SET_CLOCK_LENGTH = 8;
+
+// AdjustClock のペイロード長 (command:1 + reserved:1 + delta_us:4)
+static constexpr uint8_t ADJUST_CLOCK_LENGTH = 6;
+
+// SetFeedbackStamp のペイロード長 (command:1 + enabled:1)
+static constexpr uint8_t FEEDBACK_STAMP_ENABLE_LENGTH = 2;
+
+// SaveParameters / ClearParameters のペイロード長 (command:1 + key:1)
+static constexpr uint8_t PARAMETER_KEY_LENGTH = 2;
+
+// RequestBootProfile のペイロード長 (command:1 + phase:1)
+static constexpr uint8_t BOOT_PROFILE_REQUEST_LENGTH = 2;
+
+// SetMotionLimits のペイロード長 (command:1 + decel_ratio:1 + reserved:2 + jerk_per_s2:4)
+static constexpr uint8_t MOTION_LIMITS_LENGTH = 8;
+
+// SetTimeoutPolicy のペイロード長 (command:1 + action:1 + decel_ratio:1)
+static constexpr uint8_t TIMEOUT_POLICY_LENGTH = 3;
+
+// StartHoming のペイロード長 (command:1 + reserved:1 + backoff_mrad:2 + speed_rad_s:4)
+static constexpr uint8_t HOMING_LENGTH = 8;
+
+// SetPositionLimit のペイロード長 (command:1 + bound:1 + decel_rad_s2:2 + position_rad:4)
+static constexpr uint8_t POSITION_LIMIT_LENGTH = 8;
+
+// SetObserver のペイロード長 (command:1 + reserved:1 + bandwidth_rad_s:2 + input_gain_rad_s2:4)
+static constexpr uint8_t OBSERVER_LENGTH = 8;
+
+// SetBiquad のペイロード長 (command:1 + location:1 + stage:1 + type:1 + cutoff_hz:2 + q:2)
+static constexpr uint8_t BIQUAD_LENGTH = 8;
+
+// SetDisturbance のペイロード長 (command:1 + mode:1 + cutoff_rad_s:2 + gain_rad_s2:2 + tau_ms:2)
+static constexpr uint8_t DISTURBANCE_LENGTH = 8;
+
+// SetInputShaper のペイロード長 (command:1 + type:1 + damping:2 + frequency_hz:4)
+static constexpr uint8_t INPUT_SHAPER_LENGTH = 8;
+
+// SetBacklash のペイロード長 (command:1 + flags:1 + traverse_rad_s:2 + width_rad:4)
+static constexpr uint8_t BACKLASH_LENGTH = 8;
+
+// CalibrateFriction のペイロード長 (command:1 + revolutions:1 + reserved:2 + speed_rad_s:4)
+static constexpr uint8_t FRICTION_CALIBRATION_LENGTH = 8;
+
+// SetFriction のペイロード長 (command:1 + enabled:1)
+static constexpr uint8_t FRICTION_LENGTH = 2;
+
+// ExtendedFeedback のペイロード長 (reply:1 + limit/fault/reserved:3 + f32x5 + u64)
+static constexpr uint8_t EXTENDED_FEEDBACK_LENGTH = 32;
+
+// TimeSyncReply / FeedbackStamp のペイロード長
+static constexpr uint8_t TIME_SYNC_REPLY_LENGTH = 8;
+static constexpr uint8_t FEEDBACK_STAMP_LENGTH  = 8;
+
+// ParameterResult のペイロード長 (reply:1 + command:1 + success:1)
+static constexpr uint8_t PARAMETER_RESULT_LENGTH = 3;
+
+// BootProfile のペイロード長 (reply:1 + phase:1 + reached:1 + elapsed_us:4)
+static constexpr uint8_t BOOT_PROFILE_LENGTH = 7;
+
+// HomingResult のペイロード長 (reply:1 + status:1 + reserved:2 + origin_rad:4)
+static constexpr uint8_t HOMING_RESULT_LENGTH = 8;
+
+// Disturbance のペイロード長 (reply:1 + reserved:3 + disturbance_duty:4)
+static constexpr uint8_t DISTURBANCE_ESTIMATE_LENGTH = 8;
+
+// FrictionResult のペイロード長 (reply:1 + status:1 + positive:2 + negative:2 + ripple:2)
+static constexpr uint8_t FRICTION_RESULT_LENGTH = 8;
+
+// TimeSyncReply の折り返し時間の上限 [us] (u16)
+static constexpr uint64_t TURNAROUND_MAX_US = 0xFFFFU;
+
+static_assert(BIQUAD_STAGES * 2U <= 8U, "biquad_updated_ has one bit per stage.");
+
+/**
+ * @brief SetBiquad の更新フラグのビットを返す
+ *        feedback の段を下位ビット、output の段をその上のビットに割り当てる
+ * @param stage  段の番号
+ * @param output output の段なら true
+ * @return uint8_t 更新フラグのビット
+ */
+static uint8_t biquad_bit(std::size_t stage, bool output)
+{
+    std::size_t index = stage;
+    if (output) {
+        index += BIQUAD_STAGES;
+    }
+    return static_cast<uint8_t>(1U << index);
+}
+
+// -----------------------------------------------------------------------
+
+ExtensionServer::ExtensionServer(
+    uint8_t board_id, IExtensionTransmitter& transmitter, IClock& clock
+)
+    : board_id_(board_id),
+      transmitter_(transmitter),
+      clock_(clock),
+      clock_offset_us_(0),
+      feedback_policy_updated_(false),
+      feedback_requested_(false),
+      gains_updated_(false),
+      motion_limits_updated_(false),
+      timeout_policy_updated_(false),
+      homing_requested_(false),
+      position_min_updated_(false),
+      position_max_updated_(false),
+      observer_updated_(false),
+      biquad_updated_(0U),
+      disturbance_updated_(false),
+      input_shaper_updated_(false),
+      backlash_updated_(false),
+      friction_calibration_requested_(false),
+      friction_enabled_(false),
+      friction_enabled_updated_(false),
+      fd_enabled_(false),
+      sync_latch_enabled_(false),
+      phase_align_enabled_(false),
+      sync_received_(false),
+      phase_align_requested_(false),
+      feedback_stamp_enabled_(false),
+      parameter_action_(ParameterAction::None),
+      boot_profile_requested_(false),
+      boot_profile_phase_(extension::BootPhase::ClockConfigured),
+      time_sync_rx_us_(0),
+      time_sync_seq_(0),
+      set_clock_rx_us_(0),
+      set_clock_time_us_(0),
+      adjust_clock_us_(0),
+      time_sync_pending_(false),
+      set_clock_pending_(false),
+      adjust_clock_pending_(false)
+{
+    gains_.fill(0.0f);
+}
+
+// -----------------------------------------------------------------------
+
+bool ExtensionServer::on_receive(uint32_t id, const uint8_t* data, uint8_t length)
+{
+    if (id != extension::command_id(board_id_) && id != extension::BROADCAST_ID) {
+        return false;
+    }
+    if (length == 0) {
+        return false;
+    }
+
+    switch (static_cast<extension::Command>(data[0])) {
+        case extension::Command::SetFeedbackPolicy:
+            if (length < FEEDBACK_POLICY_LENGTH ||
+                data[1] > static_cast<uint8_t>(FeedbackMode::Polled)) {
+                return false;
+            }
+            feedback_policy_.mode            = static_cast<FeedbackMode>(data[1]);
+            feedback_policy_.period_cycles   = extension::read_le<uint16_t>(&data[2]);
+            feedback_policy_.delta_threshold = extension::read_le<float>(&data[4]);
+            feedback_policy_updated_         = true;
+            return true;
+
+        case extension::Command::RequestFeedback:
+            feedback_requested_ = true;
+            return true;
+
+        case extension::Command::SetFrameFormat:
+            if (length < FRAME_FORMAT_LENGTH) {
+                return false;
+            }
+            // CAN FD 非対応のペリフェラル (bxCAN) ではクラシックのまま維持する
+            fd_enabled_ = (data[1] != 0U) &&
+                          (transmitter_.max_payload_length() >= EXTENDED_FEEDBACK_LENGTH);
+            return true;
+
+        case extension::Command::SetGains:
+            if (length < GAINS_LENGTH) {
+                return false;
+            }
+            gains_[0]      = extension::read_le<float>(&data[1]);
+            gains_[1]      = extension::read_le<float>(&data[5]);
+            gains_[2]      = extension::read_le<float>(&data[9]);
+            gains_updated_ = true;
+            return true;
+
+        case extension::Command::SetSyncMode:
+            if (length < SYNC_MODE_LENGTH) {
+                return false;
+            }
+            sync_latch_enabled_  = (data[1] != 0U);
+            phase_align_enabled_ = (data[2] != 0U);
+            return true;
+
+        case extension::Command::Sync:
+            sync_received_ = true;
+            if (phase_align_enabled_) {
+                phase_align_requested_ = true;
+            }
+            return true;
+
+        case extension::Command::TimeSyncRequest:
+            if (length < TIME_SYNC_REQUEST_LENGTH || time_sync_pending_) {
+                return false;
+            }
+            time_sync_rx_us_   = clock_.now_us();
+            time_sync_seq_     = data[1];
+            time_sync_pending_ = true;
+            return true;
+
+        case extension::Command::SetClock:
+            if (length < SET_CLOCK_LENGTH || set_clock_pending_) {
+                return false;
+            }
+            set_clock_rx_us_   = clock_.now_us();
+            set_clock_time_us_ = extension::read_le_u48(&data[2]);
+            set_clock_pending_ = true;
+            return true;
+
+        case extension::Command::AdjustClock:
+            if (length < ADJUST_CLOCK_LENGTH || adjust_clock_pending_) {
+                return false;
+            }
+            adjust_clock_us_      = extension::read_le<int32_t>(&data[2]);
+            adjust_clock_pending_ = true;
+            return true;
+
+        case extension::Command::SetFeedbackStamp:
+            if (length < FEEDBACK_STAMP_ENABLE_LENGTH) {
+                return false;
+            }
+            feedback_stamp_enabled_ = (data[1] != 0U);
+            return true;
+
+        case extension::Command::SaveParameters:
+            if (length < PARAMETER_KEY_LENGTH || data[1] != extension::PARAMETER_KEY) {
+                return false;
+            }
+            parameter_action_ = ParameterAction::Save;
+            return true;
+
+        case extension::Command::RestoreParameters:
+            parameter_action_ = ParameterAction::Restore;
+            return true;
+
+        case extension::Command::ClearParameters:
+            if (length < PARAMETER_KEY_LENGTH || data[1] != extension::PARAMETER_KEY) {
+                return false;
+            }
+            parameter_action_ = ParameterAction::Clear;
+            return true;
+
+        case extension::Command::RequestBootProfile:
+            if (length < BOOT_PROFILE_REQUEST_LENGTH || boot_profile_requested_ ||
+                data[1] >= static_cast<uint8_t>(extension::BootPhase::Count)) {
+                return false;
+            }
+            boot_profile_phase_     = static_cast<extension::BootPhase>(data[1]);
+            boot_profile_requested_ = true;
+            return true;
+
+        case extension::Command::SetMotionLimits:
+            if (length < MOTION_LIMITS_LENGTH) {
+                return false;
+            }
+            motion_limits_.decel_ratio =
+                static_cast<float>(data[1]) / extension::MOTION_RATIO_SCALE;
+            motion_limits_.jerk_per_s2 = extension::read_le<float>(&data[4]);
+            motion_limits_updated_     = true;
+            return true;
+
+        case extension::Command::SetTimeoutPolicy:
+            if (length < TIMEOUT_POLICY_LENGTH ||
+                data[1] > static_cast<uint8_t>(TimeoutAction::Coast)) {
+                return false;
+            }
+            timeout_policy_.action = static_cast<TimeoutAction>(data[1]);
+            timeout_policy_.decel_ratio =
+                static_cast<float>(data[2]) / extension::MOTION_RATIO_SCALE;
+            timeout_policy_updated_ = true;
+            return true;
+
+        case extension::Command::StartHoming:
+            if (length < HOMING_LENGTH) {
+                return false;
+            }
+            homing_.backoff_rad = static_cast<float>(extension::read_le<uint16_t>(&data[2])) /
+                                  extension::HOMING_BACKOFF_SCALE;
+            homing_.speed_rad_s = extension::read_le<float>(&data[4]);
+            homing_requested_   = true;
+            return true;
+
+        case extension::Command::SetPositionLimit: {
+            if (length < POSITION_LIMIT_LENGTH) {
+                return false;
+            }
+            const float position_rad = extension::read_le<float>(&data[4]);
+            if (std::isnan(position_rad) ||
+                data[1] > static_cast<uint8_t>(extension::PositionBound::Max)) {
+                return false;
+            }
+            position_limits_.decel_rad_s2 =
+                static_cast<float>(extension::read_le<uint16_t>(&data[2]));
+            if (data[1] == static_cast<uint8_t>(extension::PositionBound::Min)) {
+                position_limits_.min_rad = position_rad;
+                position_min_updated_    = true;
+            } else {
+                position_limits_.max_rad = position_rad;
+                position_max_updated_    = true;
+            }
+            return true;
+        }
+
+        case extension::Command::SetObserver: {
+            if (length < OBSERVER_LENGTH) {
+                return false;
+            }
+            const uint16_t bandwidth = extension::read_le<uint16_t>(&data[2]);
+            const float input_gain   = extension::read_le<float>(&data[4]);
+            if (bandwidth > extension::OBSERVER_MAX_BANDWIDTH_RAD_S ||
+                !std::isfinite(input_gain)) {
+                return false;
+            }
+            observer_.bandwidth_rad_s   = static_cast<float>(bandwidth);
+            observer_.input_gain_rad_s2 = input_gain;
+            observer_updated_           = true;
+            return true;
+        }
+
+        case extension::Command::SetBiquad: {
+            if (length < BIQUAD_LENGTH ||
+                data[1] > static_cast<uint8_t>(extension::BiquadLocation::Output) ||
+                data[2] >= BIQUAD_STAGES || data[3] > static_cast<uint8_t>(BiquadType::Notch)) {
+                return false;
+            }
+            BiquadConfig config;
+            config.type      = static_cast<BiquadType>(data[3]);
+            config.cutoff_hz = static_cast<float>(extension::read_le<uint16_t>(&data[4]));
+            config.q = static_cast<float>(extension::read_le<uint16_t>(&data[6])) /
+                       extension::BIQUAD_Q_SCALE;
+
+            const std::size_t stage = data[2];
+            if (data[1] == static_cast<uint8_t>(extension::BiquadLocation::Output)) {
+                biquads_.output[stage] = config;
+                biquad_updated_ = static_cast<uint8_t>(biquad_updated_ | biquad_bit(stage, true));
+            } else {
+                biquads_.feedback[stage] = config;
+                biquad_updated_ = static_cast<uint8_t>(biquad_updated_ | biquad_bit(stage, false));
+            }
+            return true;
+        }
+
+        case extension::Command::SetDisturbance:
+            if (length < DISTURBANCE_LENGTH ||
+                data[1] > static_cast<uint8_t>(DisturbanceMode::Compensate)) {
+                return false;
+            }
+            disturbance_.mode = static_cast<DisturbanceMode>(data[1]);
+            disturbance_.cutoff_rad_s =
+                static_cast<float>(extension::read_le<uint16_t>(&data[2]));
+            disturbance_.gain_rad_s2 = static_cast<float>(extension::read_le<uint16_t>(&data[4]));
+            disturbance_.time_constant_s =
+                static_cast<float>(extension::read_le<uint16_t>(&data[6])) /
+                extension::DISTURBANCE_TAU_SCALE;
+            disturbance_updated_ = true;
+            return true;
+
+        case extension::Command::SetInputShaper: {
+            if (length < INPUT_SHAPER_LENGTH ||
+                data[1] > static_cast<uint8_t>(InputShaperType::EI)) {
+                return false;
+            }
+            const float frequency_hz = extension::read_le<float>(&data[4]);
+            if (!std::isfinite(frequency_hz)) {
+                return false;
+            }
+            input_shaper_.type = static_cast<InputShaperType>(data[1]);
+            input_shaper_.damping_ratio =
+                static_cast<float>(extension::read_le<uint16_t>(&data[2])) /
+                extension::SHAPER_DAMPING_SCALE;
+            input_shaper_.frequency_hz = frequency_hz;
+            input_shaper_updated_      = true;
+            return true;
+        }
+
+        case extension::Command::SetBacklash: {
+            if (length < BACKLASH_LENGTH) {
+                return false;
+            }
+            const float width_rad = extension::read_le<float>(&data[4]);
+            if (!std::isfinite(width_rad)) {
+                return false;
+            }
+            backlash_.width_rad = width_rad;
+            backlash_.traverse_rad_s =
+                static_cast<float>(extension::read_le<uint16_t>(&data[2]));
+            backlash_.freeze_integrator = (data[1] & extension::BACKLASH_FREEZE_INTEGRATOR) != 0U;
+            backlash_updated_           = true;
+            return true;
+        }
+
+        case extension::Command::CalibrateFriction:
+            if (length < FRICTION_CALIBRATION_LENGTH) {
+                return false;
+            }
+            friction_calibration_.revolutions = data[1];
+            friction_calibration_.speed_rad_s = extension::read_le<float>(&data[4]);
+            friction_calibration_requested_   = true;
+            return true;
+
+        case extension::Command::SetFriction:
+            if (length < FRICTION_LENGTH) {
+                return false;
+            }
+            friction_enabled_         = data[1] != 0U;
+            friction_enabled_updated_ = true;
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+bool ExtensionServer::get_new_feedback_policy(FeedbackPolicy& policy)
+{
+    if (!feedback_policy_updated_) {
+        return false;
+    }
+    const CriticalSection lock;
+    policy                   = feedback_policy_;
+    feedback_policy_updated_ = false;
+    return true;
+}
+
+bool ExtensionServer::get_feedback_request()
+{
+    if (!feedback_requested_) {
+        return false;
+    }
+    feedback_requested_ = false;
+    return true;
+}
+
+bool ExtensionServer::get_new_gains(std::array<float, 3>& gains)
+{
+    if (!gains_updated_) {
+        return false;
+    }
+    const CriticalSection lock;
+    gains          = gains_;
+    gains_updated_ = false;
+    return true;
+}
+
+bool ExtensionServer::get_new_motion_limits(MotionLimits& limits)
+{
+    if (!motion_limits_updated_) {
+        return false;
+    }
+    const CriticalSection lock;
+    limits                 = motion_limits_;
+    motion_limits_updated_ = false;
+    return true;
+}
+
+bool ExtensionServer::get_new_timeout_policy(TimeoutPolicy& policy)
+{
+    if (!timeout_policy_updated_) {
+        return false;
+    }
+    const CriticalSection lock;
+    policy                  = timeout_policy_;
+    timeout_policy_updated_ = false;
+    return true;
+}
+
+bool ExtensionServer::get_new_homing(HomingConfig& config)
+{
+    if (!homing_requested_) {
+        return false;
+    }
+    const CriticalSection lock;
+    config            = homing_;
+    homing_requested_ = false;
+    return true;
+}
+
+bool ExtensionServer::send_homing_result(extension::HomingStatus status, float origin_rad)
+{
+    std::array<uint8_t, HOMING_RESULT_LENGTH> data{};
+    data[0] = static_cast<uint8_t>(extension::Reply::HomingResult);
+    data[1] = static_cast<uint8_t>(status);
+    extension::write_le(&data[4], origin_rad);
+    return transmitter_.send(extension::reply_id(board_id_), data.data(), HOMING_RESULT_LENGTH);
+}
+
+bool ExtensionServer::get_new_position_limits(PositionLimits& limits)
+{
+    if (!position_min_updated_ && !position_max_updated_) {
+        return false;
+    }
+    const CriticalSection lock;
+    if (position_min_updated_) {
+        limits.min_rad        = position_limits_.min_rad;
+        position_min_updated_ = false;
+    }
+    if (position_max_updated_) {
+        limits.max_rad        = position_limits_.max_rad;
+        position_max_updated_ = false;
+    }
+    limits.decel_rad_s2 = position_limits_.decel_rad_s2;
+    return true;
+}
+
+bool ExtensionServer::get_new_observer(ObserverConfig& config)
+{
+    if (!observer_updated_) {
+        return false;
+    }
+    const CriticalSection lock;
+    config            = observer_;
+    observer_updated_ = false;
+    return true;
+}
+
+bool ExtensionServer::get_new_biquads(BiquadFilters& filters)
+{
+    if (biquad_updated_ == 0U) {
+        return false;
+    }
+    const CriticalSection lock;
+    const uint8_t updated = biquad_updated_;
+    biquad_updated_       = 0U;
+    for (std::size_t stage = 0; stage < BIQUAD_STAGES; ++stage) {
+        if ((updated & biquad_bit(stage, false)) != 0U) {
+            filters.feedback[stage] = biquads_.feedback[stage];
+        }
+        if ((updated & biquad_bit(stage, true)) != 0U) {
+            filters.output[stage] = biquads_.output[stage];
+        }
+    }
+    return true;
+}
+
+bool ExtensionServer::get_new_disturbance(DisturbanceConfig& config)
+{
+    if (!disturbance_updated_) {
+        return false;
+    }
+    const CriticalSection lock;
+    config               = disturbance_;
+    disturbance_updated_ = false;
+    return true;
+}
+
+bool ExtensionServer::send_disturbance(float disturbance_duty)
+{
+    std::array<uint8_t, DISTURBANCE_ESTIMATE_LENGTH> data{};
+    data[0] = static_cast<uint8_t>(extension::Reply::Disturbance);
+    extension::write_le(&data[4], disturbance_duty);
+    return transmitter_.send(
+        extension::reply_id(board_id_), data.data(), DISTURBANCE_ESTIMATE_LENGTH
+    );
+}
+
+bool ExtensionServer::get_new_input_shaper(InputShaperConfig& config)
+{
+    if (!input_shaper_updated_) {
+        return false;
+    }
+    const CriticalSection lock;
+    config                = input_shaper_;
+    input_shaper_updated_ = false;
+    return true;
+}
+
+bool ExtensionServer::get_new_backlash(BacklashConfig& config)
+{
+    if (!backlash_updated_) {
+        return false;
+    }
+    const CriticalSection lock;
+    config            = backlash_;
+    backlash_updated_ = false;
+    return true;
+}
+
+bool ExtensionServer::get_new_friction_calibration(FrictionCalibration& config)
+{
+    if (!friction_calibration_requested_) {
+        return false;
+    }
+    const CriticalSection lock;
+    config                          = friction_calibration_;
+    friction_calibration_requested_ = false;
+    return true;
+}
+
+bool ExtensionServer::get_new_friction_enabled(bool& enabled)
+{
+    if (!friction_enabled_updated_) {
+        return false;
+    }
+    const CriticalSection lock;
+    enabled                   = friction_enabled_;
+    friction_enabled_updated_ = false;
+    return true;
+}
+
+bool ExtensionServer::send_friction_result(
+    extension::FrictionStatus status, const FrictionMap& map, float ripple
+)
+{
+    std::array<uint8_t, FRICTION_RESULT_LENGTH> data{};
+    data[0] = static_cast<uint8_t>(extension::Reply::FrictionResult);
+    data[1] = static_cast<uint8_t>(status);
+    extension::write_le(&data[2], friction_to_fixed(map.friction_positive));
+    extension::write_le(&data[4], friction_to_fixed(map.friction_negative));
+    extension::write_le(&data[6], friction_to_fixed(ripple));
+    return transmitter_.send(extension::reply_id(board_id_), data.data(), FRICTION_RESULT_LENGTH);
+}
+
+bool ExtensionServer::get_sync()
+{
+    if (!sync_received_) {
+        return false;
+    }
+    sync_received_ = false;
+    return true;
+}
+
+bool ExtensionServer::get_phase_align_request()
+{
+    if (!phase_align_requested_) {
+        return false;
+    }
+    phase_align_requested_ = false;
+    return true;
+}
+
+ParameterAction ExtensionServer::get_parameter_action()
+{
+    if (parameter_action_ == ParameterAction::None) {
+        return ParameterAction::None;
+    }
+    const CriticalSection lock;
+    const ParameterAction action = parameter_action_;
+    parameter_action_            = ParameterAction::None;
+    return action;
+}
+
+bool ExtensionServer::send_parameter_result(ParameterAction action, bool success)
+{
+    extension::Command command = extension::Command::SaveParameters;
+    if (action == ParameterAction::Restore) {
+        command = extension::Command::RestoreParameters;
+    } else if (action == ParameterAction::Clear) {
+        command = extension::Command::ClearParameters;
+    }
+
+    std::array<uint8_t, PARAMETER_RESULT_LENGTH> data{};
+    data[0] = static_cast<uint8_t>(extension::Reply::ParameterResult);
+    data[1] = static_cast<uint8_t>(command);
+    data[2] = static_cast<uint8_t>(success);
+    return transmitter_.send(extension::reply_id(board_id_), data.data(), PARAMETER_RESULT_LENGTH);
+}
+
+bool ExtensionServer::get_boot_profile_request(extension::BootPhase& phase)
+{
+    if (!boot_profile_requested_) {
+        return false;
+    }
+    const CriticalSection lock;
+    phase                   = boot_profile_phase_;
+    boot_profile_requested_ = false;
+    return true;
+}
+
+bool ExtensionServer::send_boot_profile(
+    extension::BootPhase phase, bool reached, uint32_t elapsed_us
+)
+{
+    std::array<uint8_t, BOOT_PROFILE_LENGTH> data{};
+    data[0] = static_cast<uint8_t>(extension::Reply::BootProfile);
+    data[1] = static_cast<uint8_t>(phase);
+    data[2] = static_cast<uint8_t>(reached);
+    extension::write_le(&data[3], elapsed_us);
+    return transmitter_.send(extension::reply_id(board_id_), data.data(), BOOT_PROFILE_LENGTH);
+}
+
+void ExtensionServer::service_time_sync()
+{
+    if (set_clock_pending_) {
+        // 受信時刻に指定時刻となるようオフセットを決める (処理までの遅延を含めない)
+        clock_offset_us_   = static_cast<int64_t>(set_clock_time_us_ - set_clock_rx_us_);
+        set_clock_pending_ = false;
+    }
+    if (adjust_clock_pending_) {
+        clock_offset_us_ += adjust_clock_us_;
+        adjust_clock_pending_ = false;
+    }
+    if (!time_sync_pending_) {
+        return;
+    }
+
+    // ホストは 送信時刻 t1 / 受信時刻 t4 と rx_time_us / turnaround_us から
+    // 誤差 = rx_time_us - (t1 + t4 - turnaround_us) / 2 を求め、AdjustClock で補正する
+    const uint64_t turnaround_us = std::min(clock_.now_us() - time_sync_rx_us_, TURNAROUND_MAX_US);
+    const uint64_t rx_time_us    = time_sync_rx_us_ + static_cast<uint64_t>(clock_offset_us_);
+    std::array<uint8_t, TIME_SYNC_REPLY_LENGTH> data{};
+    data[0] = static_cast<uint8_t>(extension::Reply::TimeSyncReply);
+    data[1] = time_sync_seq_;
+    extension::write_le(&data[2], static_cast<uint32_t>(rx_time_us));
+    extension::write_le(&data[6], static_cast<uint16_t>(turnaround_us));
+    transmitter_.send(extension::reply_id(board_id_), data.data(), TIME_SYNC_REPLY_LENGTH);
+    time_sync_pending_ = false;
+}
+
+bool ExtensionServer::send_feedback_stamp(uint64_t sample_time_us)
+{
+    std::array<uint8_t, FEEDBACK_STAMP_LENGTH> data{};
+    data[0] = static_cast<uint8_t>(extension::Reply::FeedbackStamp);
+    extension::write_le_u48(&data[2], sample_time_us);
+    return transmitter_.send(extension::reply_id(board_id_), data.data(), FEEDBACK_STAMP_LENGTH);
+}
+
+bool ExtensionServer::send_extended_feedback(const ExtendedFeedback& feedback)
+{
+    std::array<uint8_t, EXTENDED_FEEDBACK_LENGTH> data{};
+    data[0] = static_cast<uint8_t>(extension::Reply::ExtendedFeedback);
+    data[1] = feedback.limit_switch;
+    data[2] = static_cast<uint8_t>(feedback.fault);
+    extension::write_le(&data[4], feedback.position_rad);
+    extension::write_le(&data[8], feedback.velocity_rad_s);
+    extension::write_le(&data[12], feedback.duty);
+    extension::write_le(&data[16], feedback.current_a);
+    extension::write_le(&data[20], feedback.temperature_degc);
+    extension::write_le(&data[24], feedback.sample_time_us);
+    return transmitter_.send(extension::reply_id(board_id_), data.data(), EXTENDED_FEEDBACK_LENGTH);
+}
+
+}  // namespace gn10_motor
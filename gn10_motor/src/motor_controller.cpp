@@ -12,10 +12,11 @@
 
 #include <algorithm>
 #include <cfloat>
+#include <cmath>
 
 namespace gn10_motor {
 
-// accel_ratio(0.0〜1.0) を AccelerationLimiter の max_acceleration [/s] に変換するスケール係数
+// accel_ratio(0.0〜1.0) を JerkLimiter の max_acceleration [/s] に変換するスケール係数
 // accel_ratio = 1.0 のとき、1ms で正規化デューティ全域(-1→1)を変化できる = 2000/s
 // 実用的に accel_ratio ≈ 0.02 (5/255) → 20/s = 50msで0→1 相当
 static constexpr float ACCEL_SCALE = 1000.0f;
@@ -29,86 +30,205 @@ static constexpr float DEFAULT_INTEGRAL_LIMIT = 0.3f;
 // -----------------------------------------------------------------------
 
 MotorController::MotorController(
-    IGateDriver& driver, IEncoder& encoder, gn10_can::devices::MotorDriverServer& can_server
+    IGateDriver& driver,
+    IEncoder& encoder,
+    gn10_can::devices::MotorDriverServer& can_server,
+    ExtensionServer& extension_server,
+    ParameterStore& parameter_store,
+    IEncoder* absolute_encoder
 )
     : driver_(driver),
       encoder_(encoder),
       can_server_(can_server),
+      extension_server_(extension_server),
+      parameter_store_(parameter_store),
+      absolute_encoder_(absolute_encoder),
       pid_(PIDConfig<float>{}),
-      accel_limiter_(ACCEL_NO_LIMIT),
+      accel_limiter_(ACCEL_NO_LIMIT, ACCEL_NO_LIMIT, 0.0f),
+      observer_(),
+      feedback_filter_(),
+      output_filter_(),
+      disturbance_observer_(),
+      input_shaper_(),
+      backlash_compensator_(),
+      friction_calibrator_(),
       target_(0.0f),
+      staged_target_(0.0f),
+      target_staged_(false),
       feedback_value_(0.0f),
+      position_rad_(0.0f),
+      velocity_rad_s_(0.0f),
+      duty_(0.0f),
+      current_a_(NAN),
+      temperature_degc_(NAN),
+      fault_(extension::FaultCode::None),
       initialized_(false),
-      no_target_count_(0)
+      limit_edge_latched_(false),
+      limit_edge_state_(0U),
+      homing_phase_(HomingPhase::None),
+      homing_target_(0.0f),
+      position_offset_rad_(0.0f),
+      calibration_phase_(CalibrationPhase::None),
+      calibration_target_(0.0f),
+      calibration_travel_(0.0f),
+      friction_target_(0.0f),
+      no_target_count_(0),
+      timeout_phase_(TimeoutPhase::None),
+      sample_time_us_(0)
 {
     gains_.fill(0.0f);
 }
 
 // -----------------------------------------------------------------------
 
+bool MotorController::load_parameters()
+{
+    StoredParameters params;
+    if (!parameter_store_.load(params)) {
+        return false;
+    }
+    // 校正中のマップを読み直したマップで上書きしないよう、先に校正を中止する
+    finish_friction_calibration(extension::FrictionStatus::Cancelled);
+    config_          = params.config;
+    gains_           = params.gains;
+    motion_limits_   = params.motion_limits;
+    timeout_policy_  = params.timeout_policy;
+    position_limits_ = params.position_limits;
+    observer_config_ = params.observer;
+    biquad_filters_  = params.biquad_filters;
+    disturbance_     = params.disturbance;
+    shaper_          = params.input_shaper;
+    backlash_        = params.backlash;
+    friction_map_    = params.friction_map;
+    fault_           = extension::FaultCode::None;
+    feedback_scheduler_.set_policy(params.feedback_policy);
+    apply_config_to_controllers();
+    initialized_ = true;
+    reset();
+    return true;
+}
+
 void MotorController::update(float dt_s, uint8_t limit_switch_state)
 {
     // CAN受信を polling して設定・ゲイン・目標値を更新
     poll_can();
 
+    // エンコーダのサンプリング時刻 (カウンタ読み取りの直前。IClock の桁上がり検出のため毎周期読む)
+    sample_time_us_ = extension_server_.now_us();
+
     // init パケット受信前は制御を行わない
     if (!initialized_) {
         return;
     }
 
-    // --- タイムアウト処理: 長時間目標値が更新されなければ停止 ---
-    if (no_target_count_ >= NO_TARGET_TIMEOUT_CYCLES) {
-        stop();
-        return;
-    }
+    // --- エンコーダ読み取り & フィードバック値計算 (タイムアウト中も位置・速度を追従する) ---
+    const int16_t count = active_encoder().read_and_reset_count();
+    feedback_value_     = feedback_filter_.update(compute_feedback(count, dt_s), dt_s);
 
-    // --- エンコーダ読み取り & フィードバック値計算 ---
-    const int16_t count = encoder_.read_and_reset_count();
-    feedback_value_     = compute_feedback(count, dt_s);
+    // --- 外乱の推定 (前の周期に出力したデューティと、その間の角速度から求める) ---
+    if (disturbance_.mode != DisturbanceMode::Off) {
+        disturbance_observer_.update(duty_, velocity_rad_s_, dt_s);
+    }
 
-    // --- 制御演算: エンコーダありなら PID、なしならオープンループ ---
-    float duty          = 0.0f;
-    const auto enc_type = config_.get_encoder_type();
-    const bool use_pid =
-        (enc_type != gn10_can::devices::EncoderType::None) &&
-        (gains_[static_cast<std::size_t>(gn10_can::devices::GainType::Kp)] != 0.0f);
-    if (use_pid) {
-        duty = pid_.update(target_, feedback_value_, dt_s);
+    // --- 制御演算: 長時間目標値が更新されなければ TimeoutPolicy に従って停止 ---
+    float duty = 0.0f;
+    if (no_target_count_ >= NO_TARGET_TIMEOUT_CYCLES) {
+        finish_homing(extension::HomingStatus::TimedOut);
+        finish_friction_calibration(extension::FrictionStatus::TimedOut);
+        duty = update_timeout(dt_s);
     } else {
-        // オープンループ: target_ をそのままデューティ [-1.0, 1.0] として扱う
-        duty = target_;
+        resume_from_timeout();
+        if (homing_phase_ != HomingPhase::None) {
+            update_homing(dt_s, limit_switch_state);
+        }
+        if (calibration_phase_ != CalibrationPhase::None) {
+            update_friction_calibration(dt_s);
+        }
+        duty = compute_duty(dt_s);
     }
 
-    // --- max_duty_ratio による出力制限 ---
-    const float max_duty = config_.get_max_duty_ratio();
-    duty                 = std::clamp(duty, -max_duty, max_duty);
-
-    // --- 加速度制限 (台形制御) ---
-    duty = accel_limiter_.update(duty, dt_s);
-
-    // --- リミットスイッチによる出力制限 ---
-    duty = apply_limit_switch(duty, limit_switch_state);
+    // --- リミットスイッチによる出力制限 (前の周期からのエッジも含める) と可動範囲による制動 ---
+    const uint8_t limit_state = limit_switch_state | limit_edge_state_;
+    limit_edge_state_         = 0U;
+    duty                      = apply_limit_switch(duty, limit_state);
+    duty                      = apply_position_limits(duty);
 
     // --- モーター出力 & フィードバック送信 ---
     driver_.output(duty);
-    can_server_.send_feedback(feedback_value_, limit_switch_state);
+    duty_ = duty;
+    if (feedback_scheduler_.should_send(feedback_value_, limit_switch_state)) {
+        send_feedback(limit_switch_state);
+        // 外乱オブザーバの推定値 (負荷センサの代わり) はフィードバックの直後に送る
+        if (disturbance_.mode != DisturbanceMode::Off) {
+            extension_server_.send_disturbance(disturbance_observer_.estimate());
+        }
+    }
+}
+
+void MotorController::on_limit_switch_edge(uint8_t limit_switch_state, int16_t pending_count)
+{
+    // 停止方向に出力中なら、次の制御周期を待たずに出力を止める
+    if (initialized_ && apply_limit_switch(duty_, limit_switch_state) != duty_) {
+        driver_.output(0.0f);
+        duty_ = 0.0f;
+    }
+
+    // 前回の読み取り以降のカウントを角度に足す (周期 1 s の角速度 = 角度として変換する)
+    // アブソリュートエンコーダで制御中はカウンタが別のため、前回の読み取り時点の角度を使う
+    float position_rad = position_rad_;
+    if (&active_encoder() == &encoder_) {
+        position_rad += encoder_.count_to_angular_velocity(pending_count, 1.0f);
+    }
+    // 取得されるまでは最初のエッジを保持する (チャタリングの後のエッジで上書きしない)
+    if (!limit_edge_latched_) {
+        limit_edge_.state        = limit_switch_state;
+        limit_edge_.position_rad = position_rad;
+        limit_edge_latched_      = true;
+    }
+    limit_edge_state_ = static_cast<uint8_t>(limit_edge_state_ | limit_switch_state);
+}
+
+bool MotorController::get_limit_switch_edge(LimitSwitchEdge& edge)
+{
+    if (!limit_edge_latched_) {
+        return false;
+    }
+    edge                = limit_edge_;
+    limit_edge_latched_ = false;
+    return true;
 }
 
 void MotorController::stop()
 {
     driver_.output(0.0f);
+    duty_ = 0.0f;
     // encoder_.reset() は呼ばない: 停止しても位置・速度情報は保持する
     pid_.reset(feedback_value_);
     accel_limiter_.reset(0.0f);
-    no_target_count_ = 0;
+    output_filter_.reset(0.0f);
+    disturbance_observer_.reset(0.0f, velocity_rad_s_);
 }
 
 void MotorController::reset()
 {
+    finish_homing(extension::HomingStatus::Cancelled);
+    finish_friction_calibration(extension::FrictionStatus::Cancelled);
+    resume_from_timeout();
     pid_.reset(feedback_value_);
     accel_limiter_.reset(0.0f);
+    observer_.reset();
+    output_filter_.reset(0.0f);
+    disturbance_observer_.reset(0.0f, velocity_rad_s_);
+    input_shaper_.reset(target_);
+    backlash_compensator_.reset(target_);
+    // 積算角度を戻すとフィードバック値が飛ぶため、次の値から改めてフィルタをかける
+    feedback_filter_.resync();
     encoder_.reset();
-    no_target_count_ = 0;
+    if (absolute_encoder_ != nullptr) {
+        absolute_encoder_->reset();
+    }
+    position_offset_rad_ = 0.0f;
+    no_target_count_     = 0;
 }
 
 // -----------------------------------------------------------------------
@@ -120,6 +240,7 @@ void MotorController::poll_can()
     // 設定 (初期化パケット)
     if (gn10_can::devices::MotorConfig new_config; can_server_.get_new_init(new_config)) {
         config_ = new_config;
+        fault_  = extension::FaultCode::None;
         apply_config_to_controllers();
         initialized_ = true;
         reset();
@@ -133,16 +254,141 @@ void MotorController::poll_can()
             gain_updated = true;
         }
     }
-    if (gain_updated) {
+    // CAN FD の一括設定 (kp, ki, kd)
+    if (std::array<float, 3> pid_gains; extension_server_.get_new_gains(pid_gains)) {
+        gains_[static_cast<std::size_t>(gn10_can::devices::GainType::Kp)] = pid_gains[0];
+        gains_[static_cast<std::size_t>(gn10_can::devices::GainType::Ki)] = pid_gains[1];
+        gains_[static_cast<std::size_t>(gn10_can::devices::GainType::Kd)] = pid_gains[2];
+        gain_updated                                                      = true;
+    }
+    // 減速側の制限・躍度制限
+    const bool limits_updated = extension_server_.get_new_motion_limits(motion_limits_);
+    // 追従オブザーバ (有効にしたときに古い推定値から始めないよう、現在の速度に合わせる)
+    const bool observer_updated = extension_server_.get_new_observer(observer_config_);
+    if (observer_updated) {
+        observer_.reset(velocity_rad_s_);
+    }
+    // biquad フィルタ (係数を変えた直後に過渡応答が出ないよう、現在の値で落ち着かせる)
+    const bool biquad_updated = extension_server_.get_new_biquads(biquad_filters_);
+    if (gain_updated || limits_updated || observer_updated || biquad_updated) {
         apply_config_to_controllers();
     }
+    if (biquad_updated) {
+        feedback_filter_.reset(feedback_value_);
+        output_filter_.reset(duty_);
+    }
+    // 外乱オブザーバ (設定を変えたら、今の出力と速度が続いていた状態から推定し直す)
+    if (extension_server_.get_new_disturbance(disturbance_)) {
+        apply_config_to_controllers();
+        disturbance_observer_.reset(duty_, velocity_rad_s_);
+    }
+    // 入力整形 (整形中の目標値の履歴は捨て、今の目標値から整形し直す)
+    if (extension_server_.get_new_input_shaper(shaper_)) {
+        apply_config_to_controllers();
+        input_shaper_.reset(target_);
+    }
+    // バックラッシ補償 (遊びの中央から補償し直す)
+    if (extension_server_.get_new_backlash(backlash_)) {
+        apply_config_to_controllers();
+        backlash_compensator_.reset(target_);
+    }
+
+    // タイムアウト時の停止方法 (タイムアウト中なら旧ポリシーの状態を解除してから切り替える)
+    if (TimeoutPolicy policy; extension_server_.get_new_timeout_policy(policy)) {
+        resume_from_timeout();
+        timeout_policy_ = policy;
+    }
+
+    // 位置制御の可動範囲 (受信した境界だけを更新する)
+    extension_server_.get_new_position_limits(position_limits_);
+
+    // 原点復帰の開始・中止
+    if (HomingConfig homing; extension_server_.get_new_homing(homing)) {
+        start_homing(homing);
+    }
+
+    // 摩擦の校正の開始・中止と、フィードフォワードの有効・無効
+    if (FrictionCalibration calibration;
+        extension_server_.get_new_friction_calibration(calibration)) {
+        start_friction_calibration(calibration);
+    }
+    extension_server_.get_new_friction_enabled(friction_map_.enabled);
+
+    // 時刻同期
+    extension_server_.service_time_sync();
 
-    // 目標値
-    if (can_server_.get_new_target(target_)) {
+    // フラッシュのパラメータ保存・読み直し・消去
+    handle_parameter_action();
+
+    // フィードバック送信ポリシー・送信要求
+    if (FeedbackPolicy policy; extension_server_.get_new_feedback_policy(policy)) {
+        feedback_scheduler_.set_policy(policy);
+    }
+    if (extension_server_.get_feedback_request()) {
+        feedback_scheduler_.request();
+    }
+
+    // 目標値: 同期モードでは受信した目標値を保留し、Sync 受信時に全ボード同時に適用する
+    if (float new_target; can_server_.get_new_target(new_target)) {
+        staged_target_   = new_target;
+        target_staged_   = true;
         no_target_count_ = 0;
-    } else {
+    } else if (no_target_count_ < NO_TARGET_TIMEOUT_CYCLES) {
+        // 新しい目標値を受信するまでタイムアウト状態を保つ
         ++no_target_count_;
     }
+    const bool synced = extension_server_.get_sync();
+    if (target_staged_ && (synced || !extension_server_.sync_latch_enabled())) {
+        target_        = staged_target_;
+        target_staged_ = false;
+    }
+}
+
+void MotorController::handle_parameter_action()
+{
+    const ParameterAction action = extension_server_.get_parameter_action();
+    bool success                 = false;
+    switch (action) {
+        case ParameterAction::Save:
+            // init 受信前の既定値は保存しない
+            // 校正途中のマップを保存しないよう、原点復帰・摩擦の校正は中止してから保存する
+            if (initialized_) {
+                finish_homing(extension::HomingStatus::Cancelled);
+                finish_friction_calibration(extension::FrictionStatus::Cancelled);
+                stop();
+                StoredParameters params;
+                params.config          = config_;
+                params.gains           = gains_;
+                params.feedback_policy = feedback_scheduler_.policy();
+                params.motion_limits   = motion_limits_;
+                params.timeout_policy  = timeout_policy_;
+                params.position_limits = position_limits_;
+                params.observer        = observer_config_;
+                params.biquad_filters  = biquad_filters_;
+                params.disturbance     = disturbance_;
+                params.input_shaper    = shaper_;
+                params.backlash        = backlash_;
+                params.friction_map    = friction_map_;
+                success                = parameter_store_.save(params);
+            }
+            break;
+
+        case ParameterAction::Restore:
+            success = load_parameters();
+            break;
+
+        case ParameterAction::Clear:
+            finish_homing(extension::HomingStatus::Cancelled);
+            finish_friction_calibration(extension::FrictionStatus::Cancelled);
+            stop();
+            success = parameter_store_.clear();
+            break;
+
+        case ParameterAction::None:
+        default:
+            return;
+    }
+    extension_server_.send_parameter_result(action, success);
 }
 
 void MotorController::apply_config_to_controllers()
@@ -159,10 +405,364 @@ void MotorController::apply_config_to_controllers()
     pid_config.output_limit   = config_.get_max_duty_ratio();
     pid_.update_config(pid_config);
 
-    // AccelerationLimiter の max_acceleration を再計算
+    // JerkLimiter の加速・減速・躍度の制限を再計算 (減速側は未設定なら加速側と同じ)
     const float accel_ratio = config_.get_accel_ratio();
     const float max_accel   = (accel_ratio > 0.0f) ? (accel_ratio * ACCEL_SCALE) : ACCEL_NO_LIMIT;
-    accel_limiter_.set_max_acceleration(max_accel);
+    float max_decel         = max_accel;
+    if (motion_limits_.decel_ratio > 0.0f) {
+        max_decel = motion_limits_.decel_ratio * ACCEL_SCALE;
+    }
+    accel_limiter_.set_limits(max_accel, max_decel, motion_limits_.jerk_per_s2);
+
+    // 追従オブザーバの帯域と入力ゲイン (ゲインは帯域の変更時に計算し直す)
+    observer_.set_bandwidth(observer_config_.bandwidth_rad_s);
+    observer_.set_input_gain(observer_config_.input_gain_rad_s2);
+
+    // biquad フィルタ (係数は設定を変えたときと制御周期が変わったときに計算し直す)
+    for (std::size_t stage = 0; stage < BIQUAD_STAGES; ++stage) {
+        feedback_filter_.set_stage(stage, biquad_filters_.feedback[stage]);
+        output_filter_.set_stage(stage, biquad_filters_.output[stage]);
+    }
+
+    // 外乱オブザーバの公称モデルと Q フィルタ
+    disturbance_observer_.configure(
+        disturbance_.cutoff_rad_s,
+        disturbance_.gain_rad_s2,
+        disturbance_.time_constant_s
+    );
+
+    // 入力整形のインパルス列 (時刻は設定を変えたときと制御周期が変わったときに計算し直す)
+    input_shaper_.configure(shaper_);
+
+    // バックラッシ補償の遊びの幅と渡る速さ
+    backlash_compensator_.configure(backlash_.width_rad, backlash_.traverse_rad_s);
+}
+
+float MotorController::compute_duty(float dt_s)
+{
+    // --- 入力整形: 目標値の列にインパルス列を畳み込み、機構の振動モードを励起しないようにする ---
+    // 原点復帰の位置目標は原点の設定で不連続に変わるため整形せず、終了後の目標値から整形を始める
+    float target = target_;
+    if (homing_phase_ == HomingPhase::None) {
+        target = input_shaper_.update(target_, dt_s);
+    } else {
+        input_shaper_.reset(target_);
+    }
+
+    // --- 制御演算: エンコーダありなら PID、なしならオープンループ ---
+    float duty          = 0.0f;
+    const auto enc_type = config_.get_encoder_type();
+    const bool use_pid =
+        (enc_type != gn10_can::devices::EncoderType::None) &&
+        (gains_[static_cast<std::size_t>(gn10_can::devices::GainType::Kp)] != 0.0f);
+    if (use_pid) {
+        // 位置目標は可動範囲内に制限する
+        if (position_limits_active()) {
+            target = std::clamp(target, position_limits_.min_rad, position_limits_.max_rad);
+        }
+
+        // 位置制御ではギアの遊びの分だけ移動方向へ目標値をずらし、反転時は遊びを速く渡る
+        // (原点復帰中は補償せず、遊びの中央にいるとみなして終了後から補償を始める)
+        bool hold_integral = false;
+        if (position_feedback() && homing_phase_ == HomingPhase::None) {
+            target        = backlash_compensator_.update(target, dt_s);
+            hold_integral = backlash_.freeze_integrator &&
+                            backlash_compensator_.hold_integral(target - feedback_value_);
+        } else {
+            backlash_compensator_.reset(target);
+        }
+        pid_.hold_integral(hold_integral);
+        duty = pid_.update(target, feedback_value_, dt_s);
+
+        // 推定した負荷を足して打ち消す (積分項で負荷の変化を待たずに済む)
+        if (disturbance_.mode == DisturbanceMode::Compensate) {
+            duty += disturbance_observer_.estimate();
+        }
+
+        // 校正した摩擦・位置ごとの負荷を打ち消す (校正中は記録を乱さないよう足さない)
+        if (friction_map_.enabled && calibration_phase_ == CalibrationPhase::None) {
+            duty += friction_feedforward(friction_map_, position_rad_, friction_direction(target));
+        }
+    } else {
+        // オープンループ: 目標値をそのままデューティ [-1.0, 1.0] として扱う
+        duty = target;
+    }
+
+    // --- 出力フィルタ (軸の共振周波数を除き、PID のゲインを上げられるようにする) ---
+    duty = output_filter_.update(duty, dt_s);
+
+    // --- max_duty_ratio による出力制限 ---
+    const float max_duty = config_.get_max_duty_ratio();
+    duty                 = std::clamp(duty, -max_duty, max_duty);
+
+    // --- 加速度制限 (台形制御) ---
+    return accel_limiter_.update(duty, dt_s);
+}
+
+float MotorController::update_timeout(float dt_s)
+{
+    if (timeout_phase_ == TimeoutPhase::None) {
+        pid_.reset(feedback_value_);
+        if (timeout_policy_.action == TimeoutAction::Stop) {
+            // 従来動作: 減速せずに即時停止する
+            accel_limiter_.reset(0.0f);
+            timeout_phase_ = TimeoutPhase::Settled;
+        } else {
+            // 減速の変化率だけを差し替え、躍度制限は通常の設定を使う
+            if (timeout_policy_.decel_ratio > 0.0f) {
+                const float decel = timeout_policy_.decel_ratio * ACCEL_SCALE;
+                accel_limiter_.set_limits(decel, decel, motion_limits_.jerk_per_s2);
+            }
+            timeout_phase_ = TimeoutPhase::Ramping;
+        }
+    }
+
+    if (timeout_phase_ == TimeoutPhase::Ramping) {
+        // JerkLimiter は目標値を通り過ぎずにちょうど 0 で止まる
+        const float duty = accel_limiter_.update(0.0f, dt_s);
+        if (duty != 0.0f) {
+            return duty;
+        }
+        settle_timeout();
+    }
+
+    if (timeout_policy_.action == TimeoutAction::Hold) {
+        return compute_duty(dt_s);
+    }
+    return 0.0f;
+}
+
+void MotorController::settle_timeout()
+{
+    // 減速用に差し替えた制限を元に戻す
+    apply_config_to_controllers();
+    timeout_phase_ = TimeoutPhase::Settled;
+
+    switch (timeout_policy_.action) {
+        case TimeoutAction::Hold:
+            // 位置制御は停止した位置、速度制御は速度 0 を保持する
+            target_ = 0.0f;
+            if (position_feedback()) {
+                target_ = feedback_value_;
+            }
+            input_shaper_.reset(target_);
+            backlash_compensator_.reset(target_);
+            pid_.reset(feedback_value_);
+            break;
+
+        case TimeoutAction::Brake:
+            driver_.set_brake(true);
+            break;
+
+        case TimeoutAction::Coast:
+            driver_.set_brake(false);
+            break;
+
+        case TimeoutAction::Stop:
+        default:
+            break;
+    }
+}
+
+void MotorController::resume_from_timeout()
+{
+    if (timeout_phase_ == TimeoutPhase::None) {
+        return;
+    }
+    if (timeout_phase_ == TimeoutPhase::Ramping) {
+        apply_config_to_controllers();
+    }
+    // 通常時はブレーキ有効 (出力 0 でショートブレーキ) に戻す
+    driver_.set_brake(true);
+    // 減速・ブレーキ中は公称モデルから外れるため、外乱の推定をやり直す
+    disturbance_observer_.reset(duty_, velocity_rad_s_);
+    if (timeout_policy_.action != TimeoutAction::Hold) {
+        pid_.reset(feedback_value_);
+    }
+    timeout_phase_ = TimeoutPhase::None;
+}
+
+void MotorController::start_homing(const HomingConfig& config)
+{
+    if (config.speed_rad_s == 0.0f) {
+        finish_homing(extension::HomingStatus::Cancelled);
+        return;
+    }
+    if (!initialized_ || !std::isfinite(config.speed_rad_s) ||
+        config_.get_encoder_type() != gn10_can::devices::EncoderType::IncrementalTotal) {
+        extension_server_.send_homing_result(
+            extension::HomingStatus::Rejected, position_offset_rad_
+        );
+        return;
+    }
+
+    // 現在位置から位置目標を動かし始める (原点復帰中の再受信は設定を差し替えて最初からやり直す)
+    finish_friction_calibration(extension::FrictionStatus::Cancelled);
+    homing_        = config;
+    homing_phase_  = HomingPhase::Releasing;
+    homing_target_ = feedback_value_;
+}
+
+void MotorController::update_homing(float dt_s, uint8_t limit_switch_state)
+{
+    const float step = homing_.speed_rad_s * dt_s;
+
+    switch (homing_phase_) {
+        case HomingPhase::Releasing:
+            // 開始時に LIM1 が入っていたら、離れるまで逆向きに動いてからエッジを探す
+            if ((limit_switch_state & HOMING_SWITCH_MASK) != 0U) {
+                homing_target_ -= step;
+                break;
+            }
+            // 離れるまでに記録したエッジは原点に使わない
+            limit_edge_latched_ = false;
+            homing_phase_       = HomingPhase::Seeking;
+            [[fallthrough]];
+
+        case HomingPhase::Seeking: {
+            LimitSwitchEdge edge;
+            if (!get_limit_switch_edge(edge) || (edge.state & HOMING_SWITCH_MASK) == 0U) {
+                homing_target_ += step;
+                break;
+            }
+            // エッジの位置 (割り込みで記録した値) を原点にし、現在位置から退避を始める
+            position_offset_rad_ += edge.position_rad;
+            position_rad_ -= edge.position_rad;
+
+            feedback_value_ = position_rad_;
+            homing_target_  = position_rad_;
+            homing_phase_   = HomingPhase::BackingOff;
+            pid_.reset(feedback_value_);
+            feedback_filter_.reset(feedback_value_);
+            break;
+        }
+
+        case HomingPhase::BackingOff: {
+            // 原点から探索と逆向きに backoff_rad だけ離れた位置で止める
+            const float backoff_target = std::copysign(homing_.backoff_rad, -homing_.speed_rad_s);
+            if ((homing_target_ - step - backoff_target) * homing_.speed_rad_s <= 0.0f) {
+                homing_target_ = backoff_target;
+                finish_homing(extension::HomingStatus::Succeeded);
+            } else {
+                homing_target_ -= step;
+            }
+            break;
+        }
+
+        case HomingPhase::None:
+        default:
+            return;
+    }
+    target_ = homing_target_;
+}
+
+void MotorController::finish_homing(extension::HomingStatus status)
+{
+    if (homing_phase_ == HomingPhase::None) {
+        return;
+    }
+    homing_phase_ = HomingPhase::None;
+    extension_server_.send_homing_result(status, position_offset_rad_);
+}
+
+void MotorController::start_friction_calibration(const FrictionCalibration& config)
+{
+    if (config.speed_rad_s == 0.0f) {
+        finish_friction_calibration(extension::FrictionStatus::Cancelled);
+        return;
+    }
+    const bool use_pid = gains_[static_cast<std::size_t>(gn10_can::devices::GainType::Kp)] != 0.0f;
+    if (!initialized_ || !std::isfinite(config.speed_rad_s) || config.revolutions == 0U ||
+        !position_feedback() || !use_pid || homing_phase_ != HomingPhase::None) {
+        extension_server_.send_friction_result(
+            extension::FrictionStatus::Rejected, friction_map_, 0.0f
+        );
+        return;
+    }
+
+    // 校正中の再受信は前の校正を中止してから、現在位置から正転で動かし始める
+    finish_friction_calibration(extension::FrictionStatus::Cancelled);
+    calibration_             = config;
+    calibration_.speed_rad_s = std::fabs(config.speed_rad_s);
+    calibration_phase_       = CalibrationPhase::Forward;
+    calibration_target_      = feedback_value_;
+    calibration_travel_      = 0.0f;
+    friction_calibrator_.begin_pass();
+}
+
+void MotorController::update_friction_calibration(float dt_s)
+{
+    constexpr float TWO_PI = 6.283185307179586f;
+
+    // 向きを変えてから CALIBRATION_SETTLE_RAD 動き、一定速度に落ち着いてから記録する
+    if (calibration_travel_ >= CALIBRATION_SETTLE_RAD) {
+        friction_calibrator_.add(position_rad_, duty_);
+    }
+
+    const float step   = calibration_.speed_rad_s * dt_s;
+    const float length = CALIBRATION_SETTLE_RAD + TWO_PI * calibration_.revolutions;
+    calibration_travel_ += step;
+    if (calibration_travel_ >= length) {
+        if (calibration_phase_ == CalibrationPhase::Backward) {
+            extension::FrictionStatus status = extension::FrictionStatus::Failed;
+            if (friction_calibrator_.finish_backward(friction_map_, calibration_.speed_rad_s)) {
+                status = extension::FrictionStatus::Succeeded;
+            }
+            finish_friction_calibration(status);
+            return;
+        }
+        // 正転の平均をマップに仮置きし、同じ区間を逆転で記録し直す
+        if (!friction_calibrator_.finish_forward(friction_map_)) {
+            finish_friction_calibration(extension::FrictionStatus::Failed);
+            return;
+        }
+        calibration_phase_  = CalibrationPhase::Backward;
+        calibration_travel_ = 0.0f;
+        friction_calibrator_.begin_pass();
+    }
+
+    if (calibration_phase_ == CalibrationPhase::Forward) {
+        calibration_target_ += step;
+    } else {
+        calibration_target_ -= step;
+    }
+    target_ = calibration_target_;
+}
+
+void MotorController::finish_friction_calibration(extension::FrictionStatus status)
+{
+    if (calibration_phase_ == CalibrationPhase::None) {
+        return;
+    }
+    // 逆転中のマップには正転の平均を仮置きしているため、完成しなければ未校正に戻す
+    float ripple = 0.0f;
+    if (status == extension::FrictionStatus::Succeeded) {
+        ripple = friction_calibrator_.ripple();
+    } else if (calibration_phase_ == CalibrationPhase::Backward) {
+        const bool enabled    = friction_map_.enabled;
+        friction_map_         = FrictionMap{};
+        friction_map_.enabled = enabled;
+    }
+    calibration_phase_ = CalibrationPhase::None;
+    extension_server_.send_friction_result(status, friction_map_, ripple);
+}
+
+float MotorController::friction_direction(float target)
+{
+    // 位置制御はエンコーダの速度 (1 周期では数カウントに量子化される) ではなく、
+    // 位置目標の移動方向で決める。位置目標が止まっていれば静止摩擦は PID に任せる
+    float reference = target;
+    if (config_.get_encoder_type() != gn10_can::devices::EncoderType::IncrementalSpeed) {
+        reference        = target - friction_target_;
+        friction_target_ = target;
+    }
+    if (reference > 0.0f) {
+        return 1.0f;
+    }
+    if (reference < 0.0f) {
+        return -1.0f;
+    }
+    return 0.0f;
 }
 
 float MotorController::apply_limit_switch(float duty, uint8_t limit_sw_state) const
@@ -186,18 +786,112 @@ float MotorController::apply_limit_switch(float duty, uint8_t limit_sw_state) co
     return duty;
 }
 
+bool MotorController::position_feedback() const
+{
+    const auto enc_type = config_.get_encoder_type();
+    return enc_type == gn10_can::devices::EncoderType::IncrementalTotal ||
+           (enc_type == gn10_can::devices::EncoderType::Absolute && absolute_encoder_ != nullptr);
+}
+
+bool MotorController::position_limits_active() const
+{
+    return position_feedback() && homing_phase_ == HomingPhase::None &&
+           position_limits_.min_rad <= position_limits_.max_rad;
+}
+
+float MotorController::apply_position_limits(float duty)
+{
+    if (!position_limits_active()) {
+        return duty;
+    }
+
+    // 範囲の外にいれば異常として通知する (init を受信するまで保持する)
+    if (fault_ == extension::FaultCode::None &&
+        (position_rad_ > position_limits_.max_rad || position_rad_ < position_limits_.min_rad)) {
+        fault_ = extension::FaultCode::PositionLimit;
+    }
+
+    // 現在の速度から一定の減速度で止まるまでの距離 (進んでいる向きの端に対してだけ考える)
+    float upper_margin = 0.0f;
+    float lower_margin = 0.0f;
+    if (position_limits_.decel_rad_s2 > 0.0f) {
+        const float stopping_rad =
+            velocity_rad_s_ * velocity_rad_s_ / (2.0f * position_limits_.decel_rad_s2);
+        if (velocity_rad_s_ > 0.0f) {
+            upper_margin = stopping_rad;
+        } else {
+            lower_margin = stopping_rad;
+        }
+    }
+
+    // 今から減速しないと範囲内に止まれなければ、外へ向かう出力を止めてブレーキで減速する
+    if (duty > 0.0f && position_rad_ + upper_margin >= position_limits_.max_rad) {
+        return 0.0f;
+    }
+    if (duty < 0.0f && position_rad_ - lower_margin <= position_limits_.min_rad) {
+        return 0.0f;
+    }
+    return duty;
+}
+
+void MotorController::send_feedback(uint8_t limit_switch_state)
+{
+    if (!extension_server_.fd_enabled()) {
+        can_server_.send_feedback(feedback_value_, limit_switch_state);
+        if (extension_server_.feedback_stamp_enabled()) {
+            extension_server_.send_feedback_stamp(sample_time_us_);
+        }
+        return;
+    }
+
+    ExtendedFeedback feedback;
+    feedback.position_rad     = position_rad_;
+    feedback.velocity_rad_s   = velocity_rad_s_;
+    feedback.duty             = duty_;
+    feedback.current_a        = current_a_;
+    feedback.temperature_degc = temperature_degc_;
+    feedback.limit_switch     = limit_switch_state;
+    feedback.fault            = fault_;
+    feedback.sample_time_us   = sample_time_us_;
+    extension_server_.send_extended_feedback(feedback);
+}
+
+IEncoder& MotorController::active_encoder()
+{
+    if (config_.get_encoder_type() == gn10_can::devices::EncoderType::Absolute &&
+        absolute_encoder_ != nullptr) {
+        return *absolute_encoder_;
+    }
+    return encoder_;
+}
+
 float MotorController::compute_feedback(int16_t count, float dt_s)
 {
+    // 拡張フィードバックで両方を通知するため、エンコーダタイプによらず速度・角度を更新する
+    IEncoder& encoder = active_encoder();
+    velocity_rad_s_   = encoder.count_to_angular_velocity(count, dt_s);
+    position_rad_     = encoder.accumulate_angle_rad(count) - position_offset_rad_;
+
+    // 追従オブザーバでカウント差分の量子化ノイズを除く (入力は前の周期に出力したデューティ)
+    if (observer_.enabled()) {
+        velocity_rad_s_ = observer_.update(velocity_rad_s_ * dt_s, dt_s, duty_);
+        position_rad_ += observer_.position_error();
+    }
+
     switch (config_.get_encoder_type()) {
         case gn10_can::devices::EncoderType::IncrementalSpeed:
-            return encoder_.count_to_angular_velocity(count, dt_s);
+            return velocity_rad_s_;
 
         case gn10_can::devices::EncoderType::IncrementalTotal:
-            return encoder_.accumulate_angle_rad(count);
+            return position_rad_;
 
-        // アブソリュートエンコーダは HTMDv2.2c では未対応のため出力を止める
+        // アブソリュートエンコーダは多回転の絶対角度で位置制御する (未搭載のボードは出力を止める)
         case gn10_can::devices::EncoderType::Absolute:
+            if (absolute_encoder_ != nullptr) {
+                return position_rad_;
+            }
             driver_.output(0.0f);
+            fault_ = extension::FaultCode::UnsupportedEncoder;
             return 0.0f;
 
         case gn10_can::devices::EncoderType::None:
@@ -0,0 +1,200 @@
+/**
+ * @file parameter_store.cpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief フラッシュへのパラメータ保存の実装
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "gn10_motor/parameter_store.hpp"
+
+#include <cstring>
+
+namespace gn10_motor {
+
+// レコード先頭のマジック ("GNPR")
+static constexpr uint32_t RECORD_MAGIC = 0x52504E47U;
+
+// 消去済みフラッシュの値
+static constexpr uint32_t ERASED_WORD = 0xFFFFFFFFU;
+
+// CRC-32 (IEEE 802.3, 反転多項式)
+static constexpr uint32_t CRC32_POLYNOMIAL = 0xEDB88320U;
+
+// レコード全体の大きさ (書き込み単位に切り上げ)
+static constexpr uint32_t RECORD_LENGTH_RAW = 16U + sizeof(StoredParameters);
+static constexpr uint32_t RECORD_LENGTH =
+    (RECORD_LENGTH_RAW + IParameterFlash::PROGRAM_UNIT - 1U) / IParameterFlash::PROGRAM_UNIT *
+    IParameterFlash::PROGRAM_UNIT;
+
+/**
+ * @brief CRC-32 を計算する (テーブルを持たないビット単位の実装)
+ * @param crc    初期値 (前段の計算結果を渡すと連結できる)
+ * @param data   データ
+ * @param length バイト数
+ * @return uint32_t CRC-32
+ */
+static uint32_t update_crc32(uint32_t crc, const uint8_t* data, uint32_t length)
+{
+    crc = ~crc;
+    for (uint32_t i = 0; i < length; ++i) {
+        crc ^= data[i];
+        for (uint8_t bit = 0; bit < 8U; ++bit) {
+            const uint32_t mask = 0U - (crc & 1U);
+            crc                 = (crc >> 1U) ^ (CRC32_POLYNOMIAL & mask);
+        }
+    }
+    return ~crc;
+}
+
+// -----------------------------------------------------------------------
+
+ParameterStore::ParameterStore(IParameterFlash& flash)
+    : flash_(flash),
+      scanned_(false),
+      active_page_(0),
+      next_offset_(0),
+      sequence_(0),
+      latest_page_(0),
+      latest_offset_(0)
+{
+    static_assert(sizeof(RecordHeader) == 16U, "RecordHeader must be packed into 16 bytes.");
+}
+
+// -----------------------------------------------------------------------
+
+bool ParameterStore::load(StoredParameters& params)
+{
+    scan();
+    if (sequence_ == 0U) {
+        return false;
+    }
+    const uint8_t* record = flash_.page_data(latest_page_) + latest_offset_;
+    std::memcpy(&params, record + sizeof(RecordHeader), sizeof(StoredParameters));
+    return true;
+}
+
+bool ParameterStore::save(const StoredParameters& params)
+{
+    if (!scanned_) {
+        scan();
+    }
+
+    // 現在のページに空きがなければ次のページを消去して使う
+    if (next_offset_ + RECORD_LENGTH > flash_.page_size()) {
+        const uint8_t next_page = static_cast<uint8_t>((active_page_ + 1U) % flash_.page_count());
+        if (!flash_.erase_page(next_page)) {
+            return false;
+        }
+        active_page_ = next_page;
+        next_offset_ = 0U;
+    }
+
+    // 制御周期の割り込みから呼ばれるため、呼び出し元の StoredParameters と合わせて
+    // スタックを使い過ぎないよう、レコードの組み立て用の領域は静的に確保する
+    static std::array<uint8_t, RECORD_LENGTH> record;
+    record.fill(0xFFU);
+    RecordHeader header;
+    header.magic    = RECORD_MAGIC;
+    header.version  = PARAMETER_VERSION;
+    header.length   = static_cast<uint16_t>(sizeof(StoredParameters));
+    header.sequence = sequence_ + 1U;
+    header.crc      = 0U;
+    std::memcpy(&record[sizeof(RecordHeader)], &params, sizeof(StoredParameters));
+    std::memcpy(record.data(), &header, sizeof(RecordHeader));
+    header.crc = update_crc32(0U, record.data(), RECORD_LENGTH_RAW);
+    std::memcpy(record.data(), &header, sizeof(RecordHeader));
+
+    const uint32_t offset = next_offset_;
+    // 書き込みに失敗したスロットは再利用できないため、成否に関わらず次へ進める
+    next_offset_ += RECORD_LENGTH;
+    if (!flash_.program(active_page_, offset, record.data(), RECORD_LENGTH)) {
+        return false;
+    }
+    if (!is_valid(flash_.page_data(active_page_) + offset)) {
+        return false;
+    }
+
+    sequence_      = header.sequence;
+    latest_page_   = active_page_;
+    latest_offset_ = offset;
+    return true;
+}
+
+bool ParameterStore::clear()
+{
+    bool ok = true;
+    for (uint8_t page = 0; page < flash_.page_count(); ++page) {
+        ok = flash_.erase_page(page) && ok;
+    }
+    scanned_       = true;
+    active_page_   = 0U;
+    next_offset_   = 0U;
+    sequence_      = 0U;
+    latest_page_   = 0U;
+    latest_offset_ = 0U;
+    return ok;
+}
+
+// -----------------------------------------------------------------------
+// 内部処理
+// -----------------------------------------------------------------------
+
+void ParameterStore::scan()
+{
+    sequence_      = 0U;
+    active_page_   = 0U;
+    next_offset_   = 0U;
+    latest_page_   = 0U;
+    latest_offset_ = 0U;
+
+    for (uint8_t page = 0; page < flash_.page_count(); ++page) {
+        const uint8_t* data = flash_.page_data(page);
+        uint32_t offset     = 0U;
+        // 追記型のため、最初の未書き込みスロットで走査を打ち切る
+        while (offset + RECORD_LENGTH <= flash_.page_size()) {
+            uint32_t magic = 0U;
+            std::memcpy(&magic, data + offset, sizeof(magic));
+            if (magic == ERASED_WORD) {
+                break;
+            }
+            if (is_valid(data + offset)) {
+                RecordHeader header;
+                std::memcpy(&header, data + offset, sizeof(RecordHeader));
+                if (header.sequence > sequence_) {
+                    sequence_      = header.sequence;
+                    latest_page_   = page;
+                    latest_offset_ = offset;
+                }
+            }
+            offset += RECORD_LENGTH;
+        }
+        // 最新レコードのあるページ (レコードがなければ走査したページ) の続きから書き込む
+        if (sequence_ == 0U || latest_page_ == page) {
+            active_page_ = page;
+            next_offset_ = offset;
+        }
+    }
+    scanned_ = true;
+}
+
+bool ParameterStore::is_valid(const uint8_t* record)
+{
+    RecordHeader header;
+    std::memcpy(&header, record, sizeof(RecordHeader));
+    if (header.magic != RECORD_MAGIC || header.version != PARAMETER_VERSION ||
+        header.length != sizeof(StoredParameters)) {
+        return false;
+    }
+
+    // CRC はフィールドを 0 として計算したものを格納している
+    const uint32_t stored_crc = header.crc;
+    header.crc                = 0U;
+    uint32_t crc = update_crc32(0U, reinterpret_cast<const uint8_t*>(&header), sizeof(header));
+    crc          = update_crc32(crc, record + sizeof(RecordHeader), sizeof(StoredParameters));
+    return crc == stored_crc;
+}
+
+}  // namespace gn10_motor
@@ -56,6 +56,8 @@ void DebugMon_Handler(void);
 void PendSV_Handler(void);
 void SysTick_Handler(void);
 void CAN_RX0_IRQHandler(void);
+void CAN_RX1_IRQHandler(void);
+void TIM1_CC_IRQHandler(void);
 void TIM6_DAC1_IRQHandler(void);
 /* USER CODE BEGIN EFP */
 
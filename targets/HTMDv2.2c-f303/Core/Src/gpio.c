@@ -72,12 +72,6 @@ void MX_GPIO_Init(void)
   GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
   HAL_GPIO_Init(GPIOA, &GPIO_InitStruct);
 
-  /*Configure GPIO pin : LIM1_Pin */
-  GPIO_InitStruct.Pin = LIM1_Pin;
-  GPIO_InitStruct.Mode = GPIO_MODE_INPUT;
-  GPIO_InitStruct.Pull = GPIO_NOPULL;
-  HAL_GPIO_Init(LIM1_GPIO_Port, &GPIO_InitStruct);
-
   /*Configure GPIO pin : DIP1_Pin */
   GPIO_InitStruct.Pin = DIP1_Pin;
   GPIO_InitStruct.Mode = GPIO_MODE_INPUT;
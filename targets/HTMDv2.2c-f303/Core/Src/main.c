@@ -67,7 +67,7 @@ void SystemClock_Config(void);
  */
 int main(void) {
     /* USER CODE BEGIN 1 */
-
+    boot_profile_start();
     /* USER CODE END 1 */
 
     /* MCU Configuration--------------------------------------------------------*/
@@ -83,7 +83,7 @@ int main(void) {
     SystemClock_Config();
 
     /* USER CODE BEGIN SysInit */
-
+    boot_profile_clock_configured();
     /* USER CODE END SysInit */
 
     /* Initialize all configured peripherals */
@@ -92,7 +92,6 @@ int main(void) {
     MX_TIM1_Init();
     MX_TIM2_Init();
     MX_TIM6_Init();
-    MX_USART1_UART_Init();
     /* USER CODE BEGIN 2 */
     setup();
     /* USER CODE END 2 */
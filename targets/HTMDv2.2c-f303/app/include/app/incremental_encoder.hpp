@@ -18,6 +18,9 @@
 
 /**
  * @brief htim1 エンコーダモードを使用するインクリメンタルエンコーダの具象クラス
+ *
+ * LIM1 (PA10 = TIM1_CH3) のエッジで CCR3 にカウンタ値を取り込む (入力キャプチャ)。
+ * キャプチャ値と同じ基準で比較できるよう、カウンタはリセットせず前回値との差分をとる。
  */
 class IncrementalEncoder : public gn10_motor::IEncoder
 {
@@ -28,15 +31,28 @@ public:
      */
     explicit IncrementalEncoder(uint16_t max_count);
 
-    /** @brief エンコーダタイマーの初期化 */
+    /** @brief エンコーダタイマーと LIM1 の入力キャプチャ (CH3) の初期化 */
     void hardware_init() override;
 
     /**
-     * @brief カウンタ値を読み取り、同時にリセットする
+     * @brief カウンタ値を読み取り、前回呼び出しからの差分を返す
      * @return int16_t 前回呼び出しからの差分カウント
      */
     int16_t read_and_reset_count() override;
 
+    /**
+     * @brief カウンタをリセットせずに読み取る (リミットスイッチのエッジ割り込み用)
+     * @return int16_t 前回の read_and_reset_count() からの差分カウント
+     */
+    int16_t peek_count() const;
+
+    /**
+     * @brief LIM1 のエッジで取り込んだカウンタ値を読み取る (入力キャプチャ割り込み用)
+     * @return int16_t 前回の read_and_reset_count() からエッジまでの差分カウント
+     *                 (エッジの後に read_and_reset_count() が呼ばれていれば負の値)
+     */
+    int16_t captured_count() const;
+
     /**
      * @brief カウント差分を角速度 [rad/s] に変換する
      * @param count  read_and_reset_count() の戻り値
@@ -65,4 +81,5 @@ private:
 
     const uint16_t max_count_;  ///< 1回転あたりのカウント数 (分解能)
     float enc_total_;           ///< 積算角度 [rad]
+    uint16_t last_count_;       ///< 前回の read_and_reset_count() のカウンタ値
 };
@@ -0,0 +1,43 @@
+/**
+ * @file parameter_flash.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief パラメータ保存用フラッシュ領域 (内蔵フラッシュ末尾 2 ページ)
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#pragma once
+
+#include <cstdint>
+
+#include "gn10_motor/i_parameter_flash.hpp"
+
+/**
+ * @brief 内蔵フラッシュ末尾のパラメータ領域
+ *
+ * 領域はリンカスクリプトの PARAM (_sparam) で確保し、プログラムが配置されないようにしている。
+ * 消去・書き込み中は同じフラッシュからの命令フェッチが止まるため、割り込みも遅延する。
+ */
+class ParameterFlash : public gn10_motor::IParameterFlash
+{
+public:
+    uint32_t page_size() const override;
+
+    uint8_t page_count() const override
+    {
+        return PAGE_COUNT;
+    }
+
+    bool erase_page(uint8_t page) override;
+
+    bool program(uint8_t page, uint32_t offset, const uint8_t* data, uint32_t length) override;
+
+    const uint8_t* page_data(uint8_t page) const override;
+
+private:
+    /// パラメータ領域のページ数 (リンカスクリプトの PARAM の大きさと一致させること)
+    static constexpr uint8_t PAGE_COUNT = 2U;
+};
@@ -0,0 +1,57 @@
+/**
+ * @file boot_profile.cpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief 起動時間の計測の実装
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#include "app/boot_profile.hpp"
+
+#include "main.h"
+
+/// 1us あたりのクロック数の換算
+static constexpr uint32_t HZ_PER_MHZ = 1000000U;
+
+BootProfile::BootProfile() : base_cycles_(0), base_us_(0), cycles_per_us_(1)
+{
+    elapsed_us_.fill(0U);
+    for (auto& reached : reached_) {
+        reached = false;
+    }
+}
+
+void BootProfile::start()
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0U;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    // リセット直後は SystemInit() が設定した内蔵発振器のクロックで動作している
+    base_cycles_   = 0U;
+    base_us_       = 0U;
+    cycles_per_us_ = SystemCoreClock / HZ_PER_MHZ;
+}
+
+void BootProfile::mark(Phase phase)
+{
+    const uint8_t index = static_cast<uint8_t>(phase);
+    if (index >= PHASE_COUNT || reached_[index]) {
+        return;
+    }
+
+    const uint32_t cycles     = DWT->CYCCNT;
+    const uint32_t elapsed_us = base_us_ + (cycles - base_cycles_) / cycles_per_us_;
+    elapsed_us_[index]        = elapsed_us;
+    reached_[index]           = true;
+
+    // クロック設定後は新しいコアクロックで換算する
+    if (phase == Phase::ClockConfigured) {
+        base_cycles_   = cycles;
+        base_us_       = elapsed_us;
+        cycles_per_us_ = SystemCoreClock / HZ_PER_MHZ;
+    }
+}
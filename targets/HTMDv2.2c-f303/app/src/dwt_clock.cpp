@@ -0,0 +1,43 @@
+/**
+ * @file dwt_clock.cpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief DWT サイクルカウンタによるボード時刻の実装
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#include "app/dwt_clock.hpp"
+
+#include "main.h"
+
+/// CYCCNT 1 周分のサイクル数
+static constexpr uint64_t CYCLES_WRAP = 1ULL << 32U;
+
+DWTClock::DWTClock() : cycles_high_(0), last_cycles_(0), cycles_per_us_(1) {}
+
+void DWTClock::init()
+{
+    cycles_per_us_ = SystemCoreClock / 1000000U;
+
+    // BootProfile が起動直後から動かしているカウンタを引き継ぐ (起動時間の計測値を壊さない)
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    last_cycles_ = DWT->CYCCNT;
+}
+
+uint64_t DWTClock::now_us()
+{
+    const uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    const uint32_t cycles = DWT->CYCCNT;
+    if (cycles < last_cycles_) {
+        cycles_high_ += CYCLES_WRAP;
+    }
+    last_cycles_         = cycles;
+    const uint64_t total = cycles_high_ | cycles;
+    __set_PRIMASK(primask);
+    return total / cycles_per_us_;
+}
@@ -0,0 +1,98 @@
+/**
+ * @file extension_can_port.cpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief 拡張コマンド用 CAN 送受信ポート (bxCAN)
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#include "app/extension_can_port.hpp"
+
+#include "gn10_motor/can_acceptance.hpp"
+#include "gn10_motor/extension_protocol.hpp"
+
+namespace {
+
+/**
+ * @brief 標準 ID を 32-bit スケールのフィルタレジスタ上位ハーフワードへ変換する
+ * @param id 標準 ID (11-bit)
+ * @return uint32_t FilterIdHigh / FilterMaskIdHigh に設定する値 (IDE=0, RTR=0)
+ */
+constexpr uint32_t to_filter_high(uint32_t id)
+{
+    return id << 5U;
+}
+
+/// 32-bit スケールのフィルタレジスタ下位ハーフワードの IDE / RTR ビット
+constexpr uint32_t FILTER_LOW_IDE_RTR = 0x0006U;
+
+}  // namespace
+
+ExtensionCANPort::ExtensionCANPort(CAN_HandleTypeDef& hcan) : hcan_(hcan) {}
+
+void ExtensionCANPort::init(uint8_t board_id)
+{
+    // 自ボード宛てコマンドとブロードキャストの2 ID を ID リストで Rx FIFO1 へ振り分ける
+    // (ID リストはマスクモードより優先されるため、ドライバの全受信フィルタより先に一致する)
+    const uint32_t command_id   = gn10_motor::extension::command_id(board_id);
+    CAN_FilterTypeDef filter    = {};
+    filter.FilterBank           = EXTENSION_FILTER_BANK;
+    filter.FilterMode           = CAN_FILTERMODE_IDLIST;
+    filter.FilterScale          = CAN_FILTERSCALE_32BIT;
+    filter.FilterIdHigh         = to_filter_high(command_id);
+    filter.FilterIdLow          = 0U;
+    filter.FilterMaskIdHigh     = to_filter_high(gn10_motor::extension::BROADCAST_ID);
+    filter.FilterMaskIdLow      = 0U;
+    filter.FilterFIFOAssignment = CAN_FILTER_FIFO1;
+    filter.FilterActivation     = CAN_FILTER_ENABLE;
+    HAL_CAN_ConfigFilter(&hcan_, &filter);
+
+    // CAN ドライバが設定する全受信フィルタ (バンク 0) を自ボード宛て gn10_can フレームの
+    // マスクフィルタで上書きし、他ボード宛てのフレームをハードウェアで破棄する
+    // (bxCAN はどのバンクにも一致しないフレームを FIFO に格納しない。デバイス種別も照合するため、
+    //  他ボード宛ての拡張コマンド・他ボードの応答 (0x700-0x7FF) も Rx FIFO0 に入らない)
+    const auto own              = gn10_motor::can_acceptance::gn10_can_filter(board_id);
+    filter.FilterBank           = GN10_CAN_FILTER_BANK;
+    filter.FilterMode           = CAN_FILTERMODE_IDMASK;
+    filter.FilterScale          = CAN_FILTERSCALE_32BIT;
+    filter.FilterIdHigh         = to_filter_high(own.id);
+    filter.FilterIdLow          = 0U;
+    filter.FilterMaskIdHigh     = to_filter_high(own.mask);
+    filter.FilterMaskIdLow      = FILTER_LOW_IDE_RTR;  // 標準 ID のデータフレームのみ
+    filter.FilterFIFOAssignment = CAN_FILTER_FIFO0;
+    HAL_CAN_ConfigFilter(&hcan_, &filter);
+
+    HAL_CAN_ActivateNotification(&hcan_, CAN_IT_RX_FIFO1_MSG_PENDING);
+}
+
+void ExtensionCANPort::on_rx_fifo1(gn10_motor::ExtensionServer& server)
+{
+    CAN_RxHeaderTypeDef header;
+    uint8_t data[gn10_motor::extension::CLASSIC_PAYLOAD_LENGTH];
+    while (HAL_CAN_GetRxFifoFillLevel(&hcan_, CAN_RX_FIFO1) > 0U) {
+        if (HAL_CAN_GetRxMessage(&hcan_, CAN_RX_FIFO1, &header, data) != HAL_OK) {
+            return;
+        }
+        server.on_receive(header.StdId, data, static_cast<uint8_t>(header.DLC));
+    }
+}
+
+bool ExtensionCANPort::send(uint32_t id, const uint8_t* data, uint8_t length)
+{
+    if (length > gn10_motor::extension::CLASSIC_PAYLOAD_LENGTH) {
+        return false;
+    }
+
+    CAN_TxHeaderTypeDef header = {};
+    header.StdId               = id;
+    header.IDE                 = CAN_ID_STD;
+    header.RTR                 = CAN_RTR_DATA;
+    header.DLC                 = length;
+    header.TransmitGlobalTime  = DISABLE;
+
+    uint32_t mailbox = 0U;
+    return HAL_CAN_AddTxMessage(&hcan_, &header, data, &mailbox) == HAL_OK;
+}
@@ -20,22 +20,40 @@
 // 2π 定数 (M_PI は POSIX 拡張のため constexpr で定義)
 static constexpr float TWO_PI = 6.28318530f;
 
-IncrementalEncoder::IncrementalEncoder(uint16_t max_count) : max_count_(max_count), enc_total_(0.0f)
+IncrementalEncoder::IncrementalEncoder(uint16_t max_count)
+    : max_count_(max_count), enc_total_(0.0f), last_count_(0U)
 {
 }
 
 void IncrementalEncoder::hardware_init()
 {
     HAL_TIM_Encoder_Start(&htim1, TIM_CHANNEL_ALL);
+
+    // CH3 は MX_TIM1_Init() で入力キャプチャに設定済み。HAL_TIM_IC_Start_IT() は
+    // エンコーダモードで使わない CH3 のチャネル状態が未初期化のため失敗するので、直接有効にする
+    __HAL_TIM_CLEAR_FLAG(&htim1, TIM_FLAG_CC3);
+    __HAL_TIM_ENABLE_IT(&htim1, TIM_IT_CC3);
+    TIM_CCxChannelCmd(TIM1, TIM_CHANNEL_3, TIM_CCx_ENABLE);
 }
 
 int16_t IncrementalEncoder::read_and_reset_count()
 {
-    // 読み取りとリセットの間に割り込みが入ると最大 1 ティックの誤差が生じる
-    // 許容誤差範囲内であるため対策しない
-    uint16_t raw = TIM1->CNT;
-    TIM1->CNT    = 0U;
-    return static_cast<int16_t>(raw);
+    // カウンタは書き換えずに差分をとる (16-bit の折り返しは int16_t への変換で吸収する)
+    // 読み取りとリセットの間の取りこぼしがなく、キャプチャ値とも同じ基準で比較できる
+    const uint16_t raw = TIM1->CNT;
+    const int16_t diff = static_cast<int16_t>(raw - last_count_);
+    last_count_        = raw;
+    return diff;
+}
+
+int16_t IncrementalEncoder::peek_count() const
+{
+    return static_cast<int16_t>(TIM1->CNT - last_count_);
+}
+
+int16_t IncrementalEncoder::captured_count() const
+{
+    return static_cast<int16_t>(TIM1->CCR3 - last_count_);
 }
 
 float IncrementalEncoder::count_to_rad(int16_t count) const
@@ -56,6 +74,6 @@ float IncrementalEncoder::accumulate_angle_rad(int16_t count)
 
 void IncrementalEncoder::reset()
 {
-    enc_total_ = 0.0f;
-    TIM1->CNT  = 0U;
+    enc_total_  = 0.0f;
+    last_count_ = TIM1->CNT;
 }
\ No newline at end of file
@@ -18,6 +18,7 @@
  * @brief A3921 IC を使用したゲートドライバの具象クラス
  *
  * htim2 (CH1/CH2) と PHASE/SR GPIO を使用してモーターを駆動する。
+ * output() は毎制御周期呼ばれるため、HAL を経由せず BoardTraits のレジスタへ直接書き込む。
  */
 class A3921GateDriver : public gn10_motor::IGateDriver
 {
@@ -46,4 +47,5 @@ public:
 
 private:
     uint16_t max_duty_;  ///< PWMタイマーの最大デューティ値
+    bool forward_;       ///< 現在の PHASE ピン状態 (true: 正転)
 };
\ No newline at end of file
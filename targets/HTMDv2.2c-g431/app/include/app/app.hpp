@@ -19,6 +19,13 @@ extern "C" {
 
 void setup();
 void loop();
+
+/** @brief 起動時間の計測を開始する (main() の先頭で呼ぶ) */
+void boot_profile_start();
+
+/** @brief システムクロックの設定完了を記録する (SystemClock_Config() の直後で呼ぶ) */
+void boot_profile_clock_configured();
+
 #ifdef __cplusplus
 }
 #endif
\ No newline at end of file
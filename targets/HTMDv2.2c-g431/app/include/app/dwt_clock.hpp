@@ -0,0 +1,48 @@
+/**
+ * @file dwt_clock.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief DWT サイクルカウンタによるボード時刻
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#pragma once
+
+#include <cstdint>
+
+#include "gn10_motor/i_clock.hpp"
+
+/**
+ * @brief DWT のサイクルカウンタ (CYCCNT) を 64-bit に拡張したボード時刻
+ *
+ * タイマーペリフェラルを消費しないよう、コアのフリーランカウンタを使用する。
+ * CYCCNT は 32-bit のため 2^32 サイクル (64MHz で約 67s) ごとに桁あふれする。
+ * now_us() の呼び出し間隔がそれより短い限り桁上がりを検出できる
+ * (MotorController が毎制御周期呼び出す)。
+ */
+class DWTClock : public gn10_motor::IClock
+{
+public:
+    DWTClock();
+
+    /**
+     * @brief サイクルカウンタを有効化する
+     *        SystemClock_Config() 後に呼ぶこと (SystemCoreClock から分周比を決める)
+     */
+    void init();
+
+    /**
+     * @brief 起動からの経過時間を返す
+     *        桁上がり検出の競合を避けるため、読み取り中は割り込みを禁止する
+     * @return uint64_t 経過時間 [us]
+     */
+    uint64_t now_us() override;
+
+private:
+    uint64_t cycles_high_;    ///< 桁上がりを積算した上位 32-bit
+    uint32_t last_cycles_;    ///< 前回読み取った CYCCNT
+    uint32_t cycles_per_us_;  ///< 1us あたりのコアクロック数
+};
@@ -0,0 +1,65 @@
+/**
+ * @file extension_can_port.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief 拡張コマンド用 CAN 送受信ポート (FDCAN)
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#pragma once
+
+#include <cstdint>
+
+#include "fdcan.h"
+#include "gn10_motor/extension_server.hpp"
+#include "gn10_motor/i_extension_transmitter.hpp"
+
+/**
+ * @brief 拡張コマンドを Rx FIFO1 で受信し、応答を CAN FD で送信するクラス
+ *
+ * gn10_can のドライバは Rx FIFO0 を使用するため、拡張コマンドの ID だけを
+ * ハードウェアフィルタで Rx FIFO1 へ振り分け、CANBus を経由せずに処理する。
+ * 自ボード宛て以外のフレームはハードウェアフィルタで破棄する (can_acceptance.hpp)。
+ * 8 byte を超える応答は CAN FD (BRS あり) で送信する。
+ */
+class ExtensionCANPort : public gn10_motor::IExtensionTransmitter
+{
+public:
+    /**
+     * @brief コンストラクタ
+     * @param hfdcan FDCAN ハンドル
+     */
+    explicit ExtensionCANPort(FDCAN_HandleTypeDef& hfdcan);
+
+    /**
+     * @brief 受信フィルタ設定と Rx FIFO1 割り込みの有効化
+     *        CAN ドライバの init() が設定した全受信フィルタを上書きするため、その後に呼ぶこと
+     * @param board_id DIP スイッチのボード ID [0-15]
+     */
+    void init(uint8_t board_id);
+
+    /**
+     * @brief Rx FIFO1 の受信フレームをすべて ExtensionServer へ渡す
+     *        HAL_FDCAN_RxFifo1Callback から呼ぶ
+     * @param server 受信フレームの渡し先
+     */
+    void on_rx_fifo1(gn10_motor::ExtensionServer& server);
+
+    bool send(uint32_t id, const uint8_t* data, uint8_t length) override;
+
+    uint8_t max_payload_length() const override
+    {
+        return gn10_motor::extension::FD_PAYLOAD_LENGTH;
+    }
+
+private:
+    FDCAN_HandleTypeDef& hfdcan_;
+
+    // 標準 ID フィルタ番号 (MX_FDCAN1_Init の StdFiltersNbr 未満であること)
+    static constexpr uint32_t EXTENSION_FILTER_INDEX        = 0U;  ///< 自ボード宛て拡張コマンド
+    static constexpr uint32_t EXTENSION_REJECT_FILTER_INDEX = 1U;  ///< 他の拡張 ID 帯の破棄
+    static constexpr uint32_t GN10_CAN_FILTER_INDEX         = 2U;  ///< 自ボード宛て gn10_can
+};
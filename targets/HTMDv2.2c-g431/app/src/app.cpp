@@ -15,14 +15,23 @@
 #include <optional>
 
 #include "app/a3921_gate_driver.hpp"
+#include "app/board_traits.hpp"
+#include "app/boot_profile.hpp"
+#include "app/dwt_clock.hpp"
+#include "app/extension_can_port.hpp"
+#include "app/fast_io.hpp"
 #include "app/incremental_encoder.hpp"
+#include "app/parameter_flash.hpp"
 #include "drivers/stm32_fdcan/driver_stm32_fdcan.hpp"
 #include "fdcan.h"
 #include "gn10_can/core/can_bus.hpp"
 #include "gn10_can/devices/motor_driver_server.hpp"
+#include "gn10_motor/extension_server.hpp"
 #include "gn10_motor/motor_controller.hpp"
+#include "gn10_motor/parameter_store.hpp"
 #include "gpio.h"
 #include "tim.h"
+#include "usart.h"
 
 // ---------------------------------------------------------------------------
 // ファイルローカル定数
@@ -50,6 +59,8 @@ constexpr uint32_t LED1_BLINK_CYCLES = 100U;
  *
  * 生成順の依存関係:
  *   can_driver_ → can_bus_ → (setup時) can_server_ → motor_
+ *   extension_port_, clock_ → (setup時) extension_server_ → motor_
+ *   parameter_flash_ → parameter_store_ → motor_
  */
 class App
 {
@@ -57,9 +68,12 @@ public:
     App()
         : can_driver_(&hfdcan1),
           can_bus_(can_driver_),
+          extension_port_(hfdcan1),
           gate_driver_(PWM_MAX_DUTY),
           encoder_(ENCODER_MAX_COUNT),
-          led1_count_(0)
+          parameter_store_(parameter_flash_),
+          led1_count_(0),
+          deferred_init_done_(false)
     {
     }
 
@@ -69,25 +83,56 @@ public:
      */
     void setup()
     {
+        boot_profile_.mark(BootProfile::Phase::PeripheralsInitialized);
+
         const uint8_t board_id = read_board_id();
 
         // CAN ドライバ初期化 (フィルタ設定 + 受信割り込み有効)
         can_driver_.init();
 
-        // ゲートドライバ・エンコーダ初期化
+        // ゲートドライバ・エンコーダ・ボード時刻初期化
         gate_driver_.hardware_init();
         encoder_.hardware_init();
+        clock_.init();
 
         // 実行時パラメータが必要なオブジェクトを構築
         can_server_.emplace(can_bus_, board_id);
-        motor_.emplace(gate_driver_, encoder_, *can_server_);
+        extension_server_.emplace(board_id, extension_port_, clock_);
+        extension_port_.init(board_id);
+        motor_.emplace(gate_driver_, encoder_, *can_server_, *extension_server_, parameter_store_);
+
+        // フラッシュに保存済みのパラメータがあればホストからの初期化を待たずに制御可能にする
+        motor_->load_parameters();
 
         // 制御タイマー (htim6) 割り込み開始
         HAL_TIM_Base_Start_IT(&htim6);
+        boot_profile_.mark(BootProfile::Phase::ControlStarted);
+    }
+
+    /**
+     * @brief メインループ
+     *        制御は割り込み駆動のため、制御ループ起動後の遅延初期化だけを行う
+     */
+    void loop()
+    {
+        if (!deferred_init_done_) {
+            deferred_init();
+            deferred_init_done_ = true;
+            boot_profile_.mark(BootProfile::Phase::DeferredInitDone);
+        }
     }
 
-    /** @brief メインループ (全処理は割り込み駆動のため空) */
-    void loop() {}
+    /** @brief 起動時間の計測を開始する (main() の先頭から呼ばれる) */
+    void on_boot()
+    {
+        boot_profile_.start();
+    }
+
+    /** @brief システムクロックの設定完了を記録する */
+    void on_clock_configured()
+    {
+        boot_profile_.mark(BootProfile::Phase::ClockConfigured);
+    }
 
     /**
      * @brief CAN受信割り込みハンドラ
@@ -98,6 +143,24 @@ public:
         can_bus_.update();
     }
 
+    /**
+     * @brief 拡張コマンド受信割り込みハンドラ (Rx FIFO1)
+     *        位相合わせが有効なら Sync 受信時に制御周期の位相を揃える
+     */
+    void on_extension_rx(FDCAN_HandleTypeDef* /*hfdcan*/)
+    {
+        if (!extension_server_.has_value()) {
+            return;
+        }
+        extension_port_.on_rx_fifo1(*extension_server_);
+
+        // Sync 受信から一定時間後に制御周期が来るよう TIM6 のカウンタを揃え、
+        // バス上の全ボードの制御ループを同じ位相で動かす
+        if (extension_server_->get_phase_align_request()) {
+            __HAL_TIM_SET_COUNTER(&htim6, 0U);
+        }
+    }
+
     /**
      * @brief タイマー割り込みハンドラ (htim6 のみ処理)
      *        毎制御周期 (1ms) に MotorController と LED を更新する
@@ -108,14 +171,43 @@ public:
             return;
         }
 
-        // リミットスイッチ状態取得 (bit0 = LIM1)
-        const uint8_t limit_sw = HAL_GPIO_ReadPin(LIM1_GPIO_Port, LIM1_Pin) ? 1U : 0U;
-
-        motor_->update(CONTROL_DT_S, limit_sw);
+        motor_->update(CONTROL_DT_S, read_limit_switches());
         update_leds();
+
+        if (!boot_profile_.reached(BootProfile::Phase::FirstControlTick)) {
+            boot_profile_.mark(BootProfile::Phase::FirstControlTick);
+        }
+        report_boot_profile();
+    }
+
+    /**
+     * @brief リミットスイッチの入力キャプチャ割り込みハンドラ (htim1 CH3 = LIM1 のみ処理)
+     *        停止方向に出力中なら制御周期を待たずに出力を止め、エッジで取り込んだ位置を記録する
+     *        (TIM1_CC の優先度は htim6 と同じにし、update() の途中では呼ばれない)
+     */
+    void on_limit_switch(TIM_HandleTypeDef* htim)
+    {
+        if (htim->Instance != TIM1 || htim->Channel != HAL_TIM_ACTIVE_CHANNEL_3 ||
+            !motor_.has_value()) {
+            return;
+        }
+        motor_->on_limit_switch_edge(read_limit_switches(), encoder_.captured_count());
     }
 
 private:
+    /**
+     * @brief リミットスイッチ状態を読み取る
+     * @return uint8_t リミットスイッチ状態 (bit0 = LIM1)
+     */
+    static uint8_t read_limit_switches()
+    {
+        uint8_t limit_sw = 0U;
+        if (fast_io::read_pin(BoardTraits::lim1_port(), BoardTraits::LIM1_PIN)) {
+            limit_sw |= 0b0001U;
+        }
+        return limit_sw;
+    }
+
     /**
      * @brief DIP スイッチを読み取りボード ID を返す
      *        DIP4=bit0(LSB), DIP3=bit1, DIP2=bit2, DIP1=bit3(MSB)
@@ -131,6 +223,30 @@ private:
         return id;
     }
 
+    /**
+     * @brief 制御に不要な周辺機能を初期化する (メインループから1回だけ呼ぶ)
+     *        制御ループの起動を遅らせないよう setup() から外している
+     */
+    void deferred_init()
+    {
+        // printf のリターゲット先 (retarget_io.c)
+        MX_USART1_UART_Init();
+    }
+
+    /**
+     * @brief RequestBootProfile を受信していれば起動フェーズの到達時刻を返す
+     */
+    void report_boot_profile()
+    {
+        BootProfile::Phase phase = BootProfile::Phase::ClockConfigured;
+        if (!extension_server_->get_boot_profile_request(phase)) {
+            return;
+        }
+        extension_server_->send_boot_profile(
+            phase, boot_profile_.reached(phase), boot_profile_.elapsed_us(phase)
+        );
+    }
+
     /**
      * @brief LED 状態を更新する (タイマー割り込みから毎制御周期呼ぶ)
      *
@@ -146,13 +262,15 @@ private:
         // LED1: 100周期ごとにトグル
         ++led1_count_;
         if (led1_count_ >= LED1_BLINK_CYCLES) {
-            HAL_GPIO_TogglePin(LED1_GPIO_Port, LED1_Pin);
+            fast_io::toggle_pin(BoardTraits::led_heartbeat_port(), BoardTraits::LED_HEARTBEAT_PIN);
             led1_count_ = 0;
         }
 
         // LED4は初期化後点灯
         if (motor_->is_initialized()) {
-            HAL_GPIO_WritePin(LED4_GPIO_Port, LED4_Pin, GPIO_PIN_SET);
+            fast_io::write_pin(
+                BoardTraits::led_initialized_port(), BoardTraits::LED_INITIALIZED_PIN, true
+            );
         }
 
         if (!motor_.has_value()) {
@@ -162,28 +280,37 @@ private:
         const float target = motor_->get_target();
 
         // LED2: 逆回転 (target < 0) のとき点灯
-        HAL_GPIO_WritePin(
-            LED2_GPIO_Port, LED2_Pin, (target < 0.0f) ? GPIO_PIN_SET : GPIO_PIN_RESET
+        fast_io::write_pin(
+            BoardTraits::led_reverse_port(), BoardTraits::LED_REVERSE_PIN, target < 0.0f
         );
 
         // LED3: 回転中 (target != 0) のとき点灯
-        HAL_GPIO_WritePin(
-            LED3_GPIO_Port, LED3_Pin, (target != 0.0f) ? GPIO_PIN_SET : GPIO_PIN_RESET
+        fast_io::write_pin(
+            BoardTraits::led_rotating_port(), BoardTraits::LED_ROTATING_PIN, target != 0.0f
         );
     }
 
     // --- ハードウェア層 (コンストラクタで安全に生成できる) ---
     gn10_can::drivers::DriverSTM32FDCAN can_driver_;  ///< STM32 CAN ハードウェアドライバ
     gn10_can::CANBus can_bus_;                        ///< CAN バスルーター
+    ExtensionCANPort extension_port_;                 ///< 拡張コマンド送受信ポート
+    DWTClock clock_;                                  ///< ボード時刻 (DWT サイクルカウンタ)
     A3921GateDriver gate_driver_;                     ///< A3921 ゲートドライバ
     IncrementalEncoder encoder_;                      ///< インクリメンタルエンコーダ
+    ParameterFlash parameter_flash_;                  ///< パラメータ保存用フラッシュ領域
+    gn10_motor::ParameterStore parameter_store_;      ///< 保存パラメータの読み書き
 
     // --- 実行時パラメータが必要なオブジェクト (setup() で emplace 構築) ---
     std::optional<gn10_can::devices::MotorDriverServer> can_server_;
+    std::optional<gn10_motor::ExtensionServer> extension_server_;
     std::optional<gn10_motor::MotorController> motor_;
 
     // --- LED 状態 ---
     uint32_t led1_count_;  ///< LED1 点滅カウンタ
+
+    // --- 起動処理 ---
+    BootProfile boot_profile_;  ///< 起動フェーズの到達時刻
+    bool deferred_init_done_;   ///< 遅延初期化が完了したか
 };
 
 App gn10_app;
@@ -204,14 +331,34 @@ void loop()
     gn10_app.loop();
 }
 
+void boot_profile_start()
+{
+    gn10_app.on_boot();
+}
+
+void boot_profile_clock_configured()
+{
+    gn10_app.on_clock_configured();
+}
+
 extern "C" {
 void HAL_FDCAN_RxFifo0Callback(FDCAN_HandleTypeDef* hfdcan, uint32_t RxFifo0ITs)
 {
     gn10_app.on_can_rx(hfdcan);
 }
 
+void HAL_FDCAN_RxFifo1Callback(FDCAN_HandleTypeDef* hfdcan, uint32_t RxFifo1ITs)
+{
+    gn10_app.on_extension_rx(hfdcan);
+}
+
 void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef* htim)
 {
     gn10_app.on_timer(htim);
 }
+
+void HAL_TIM_IC_CaptureCallback(TIM_HandleTypeDef* htim)
+{
+    gn10_app.on_limit_switch(htim);
+}
 }  // extern "C"
@@ -0,0 +1,63 @@
+/**
+ * @file parameter_flash.cpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief パラメータ保存用フラッシュ領域の実装 (STM32G4)
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#include "app/parameter_flash.hpp"
+
+#include <cstring>
+
+#include "main.h"
+
+/// リンカスクリプトで確保したパラメータ領域の先頭
+extern "C" const uint8_t _sparam[];
+
+uint32_t ParameterFlash::page_size() const
+{
+    return FLASH_PAGE_SIZE;
+}
+
+bool ParameterFlash::erase_page(uint8_t page)
+{
+    const uintptr_t address = reinterpret_cast<uintptr_t>(page_data(page));
+
+    FLASH_EraseInitTypeDef erase = {};
+    erase.TypeErase              = FLASH_TYPEERASE_PAGES;
+    erase.Banks                  = FLASH_BANK_1;
+    erase.Page                   = (address - FLASH_BASE) / FLASH_PAGE_SIZE;
+    erase.NbPages                = 1U;
+    uint32_t page_error          = 0U;
+
+    HAL_FLASH_Unlock();
+    __HAL_FLASH_CLEAR_FLAG(FLASH_FLAG_ALL_ERRORS);
+    const HAL_StatusTypeDef status = HAL_FLASHEx_Erase(&erase, &page_error);
+    HAL_FLASH_Lock();
+    return status == HAL_OK;
+}
+
+bool ParameterFlash::program(uint8_t page, uint32_t offset, const uint8_t* data, uint32_t length)
+{
+    const uintptr_t address = reinterpret_cast<uintptr_t>(page_data(page)) + offset;
+
+    HAL_FLASH_Unlock();
+    __HAL_FLASH_CLEAR_FLAG(FLASH_FLAG_ALL_ERRORS);
+    HAL_StatusTypeDef status = HAL_OK;
+    for (uint32_t i = 0; i < length && status == HAL_OK; i += PROGRAM_UNIT) {
+        uint64_t doubleword = 0U;
+        std::memcpy(&doubleword, data + i, PROGRAM_UNIT);
+        status = HAL_FLASH_Program(FLASH_TYPEPROGRAM_DOUBLEWORD, address + i, doubleword);
+    }
+    HAL_FLASH_Lock();
+    return status == HAL_OK;
+}
+
+const uint8_t* ParameterFlash::page_data(uint8_t page) const
+{
+    return _sparam + static_cast<uint32_t>(page) * FLASH_PAGE_SIZE;
+}
@@ -84,10 +84,8 @@ void MX_GPIO_Init(void)
   GPIO_InitStruct.Pull = GPIO_NOPULL;
   HAL_GPIO_Init(DIP4_GPIO_Port, &GPIO_InitStruct);
 
-  /*Configure GPIO pins : DIP3_Pin DIP2_Pin DIP1_Pin LIM2_Pin
-                           LIM1_Pin */
-  GPIO_InitStruct.Pin = DIP3_Pin|DIP2_Pin|DIP1_Pin|LIM2_Pin
-                          |LIM1_Pin;
+  /*Configure GPIO pins : DIP3_Pin DIP2_Pin DIP1_Pin LIM2_Pin */
+  GPIO_InitStruct.Pin = DIP3_Pin|DIP2_Pin|DIP1_Pin|LIM2_Pin;
   GPIO_InitStruct.Mode = GPIO_MODE_INPUT;
   GPIO_InitStruct.Pull = GPIO_NOPULL;
   HAL_GPIO_Init(GPIOB, &GPIO_InitStruct);
@@ -99,6 +97,16 @@ void MX_GPIO_Init(void)
   GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
   HAL_GPIO_Init(GPIOB, &GPIO_InitStruct);
 
+  /*Configure GPIO pin : LIM1_Pin */
+  GPIO_InitStruct.Pin = LIM1_Pin;
+  GPIO_InitStruct.Mode = GPIO_MODE_IT_RISING;
+  GPIO_InitStruct.Pull = GPIO_NOPULL;
+  HAL_GPIO_Init(LIM1_GPIO_Port, &GPIO_InitStruct);
+
+  /* EXTI interrupt init*/
+  HAL_NVIC_SetPriority(EXTI9_5_IRQn, 3, 0);
+  HAL_NVIC_EnableIRQ(EXTI9_5_IRQn);
+
 }
 
 /* USER CODE BEGIN 2 */
@@ -70,7 +70,7 @@ void SystemClock_Config(void);
 int main(void)
 {
     /* USER CODE BEGIN 1 */
-
+    boot_profile_start();
     /* USER CODE END 1 */
 
     /* MCU Configuration--------------------------------------------------------*/
@@ -86,18 +86,15 @@ int main(void)
     SystemClock_Config();
 
     /* USER CODE BEGIN SysInit */
-
+    boot_profile_clock_configured();
     /* USER CODE END SysInit */
 
     /* Initialize all configured peripherals */
     MX_GPIO_Init();
     MX_FDCAN1_Init();
-    MX_I2C1_Init();
-    MX_SPI2_Init();
     MX_TIM1_Init();
     MX_TIM2_Init();
     MX_TIM6_Init();
-    MX_USART3_UART_Init();
     /* USER CODE BEGIN 2 */
     setup();
     /* USER CODE END 2 */
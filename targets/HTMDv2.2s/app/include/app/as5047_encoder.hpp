@@ -0,0 +1,127 @@
+/**
+ * @file as5047_encoder.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief SPI2 + DMA で読み取る AS5047P アブソリュートエンコーダ
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#pragma once
+
+#include <cstdint>
+
+#include "gn10_motor/i_encoder.hpp"
+#include "spi.h"
+
+/**
+ * @brief AS5047P (14-bit 磁気式アブソリュートエンコーダ) の具象クラス
+ *
+ * 制御周期の先頭で start_transfer() を呼ぶと、16-bit 1 フレームの読み取りを DMA で開始する。
+ * 8 MHz で 1 フレームは約 2 us のため、MotorController::update() が read_and_reset_count() を
+ * 呼ぶ時点で転送は終わっており、CPU は転送を待たない。
+ *
+ * AS5047P は読み取りコマンドの応答を次のフレームで返すため、毎周期 ANGLECOM の読み取りを
+ * 送り、前の周期のフレーム終了時に取り込まれた角度を受け取る (遅れは常に 1 制御周期)。
+ *
+ * 1 回転内の角度の差分を ±半回転に折り返して積算し、多回転の角度にする。
+ * reset() では積算角度を 1 回転内の絶対角度に戻すため、原点復帰なしで絶対角度が得られる。
+ */
+class AS5047Encoder : public gn10_motor::IEncoder
+{
+public:
+    /**
+     * @brief コンストラクタ
+     * @param hspi 使用する SPI ハンドル (MX_SPI2_Init() で 16-bit・モード 1 に設定済みのもの)
+     */
+    explicit AS5047Encoder(SPI_HandleTypeDef& hspi);
+
+    /**
+     * @brief DMA チャネルを設定し、現在の角度を読み取る
+     *        MX_SPI2_Init() の後、制御タイマーの起動前に呼ぶこと
+     */
+    void hardware_init() override;
+
+    /**
+     * @brief 角度の読み取りを開始する (タイマー割り込みの先頭で毎周期 1 回呼ぶ)
+     */
+    void start_transfer();
+
+    /**
+     * @brief 転送結果を受け取り、前回からの角度の差分を返す
+     *        転送の失敗・パリティ異常・エラーフラグのときは 0 を返し、前回の角度を保つ
+     * @return int16_t 前回呼び出しからの差分カウント (±半回転に折り返し済み)
+     */
+    int16_t read_and_reset_count() override;
+
+    /**
+     * @brief カウント差分を角速度 [rad/s] に変換する
+     * @param count  read_and_reset_count() の戻り値
+     * @param period_s 制御周期 [s]
+     * @return float 角速度 [rad/s]
+     */
+    float count_to_angular_velocity(int16_t count, float period_s) override;
+
+    /**
+     * @brief カウント差分を積算し、多回転の角度 [rad] を返す
+     * @param count read_and_reset_count() の戻り値
+     * @return float 積算角度 [rad]
+     */
+    float accumulate_angle_rad(int16_t count) override;
+
+    /** @brief 積算角度を 1 回転内の絶対角度に戻す (回転数を 0 にする) */
+    void reset() override;
+
+private:
+    /**
+     * @brief DMA チャネルを SPI の送受信用に設定する
+     * @param hdma      設定する DMA ハンドル
+     * @param channel   DMA チャネル
+     * @param request   DMAMUX のリクエスト番号
+     * @param direction 転送方向
+     */
+    static void init_dma_channel(
+        DMA_HandleTypeDef& hdma, DMA_Channel_TypeDef* channel, uint32_t request, uint32_t direction
+    );
+
+    /**
+     * @brief 受信フレームを検証する (偶数パリティ、エラーフラグ)
+     * @param frame 受信フレーム
+     * @return true 角度として使える
+     */
+    static bool is_valid_frame(uint16_t frame);
+
+    /**
+     * @brief DMA での転送完了を待ち、CS を戻す
+     * @return true 転送が完了した
+     */
+    bool finish_transfer();
+
+    SPI_HandleTypeDef& hspi_;
+    DMA_HandleTypeDef hdma_rx_;
+    DMA_HandleTypeDef hdma_tx_;
+
+    uint16_t tx_frame_;           ///< DMA で送るコマンド (ANGLECOM の読み取り)
+    volatile uint16_t rx_frame_;  ///< DMA が書き込む受信フレーム
+    bool transfer_pending_;       ///< start_transfer() 後、結果を受け取っていなければ true
+
+    uint16_t last_angle_;  ///< 前回の 1 回転内の角度 [count]
+    int32_t total_count_;  ///< 多回転の積算カウント
+
+    /// 1 回転あたりのカウント数 (14-bit)
+    static constexpr int32_t COUNTS_PER_REV = 16384;
+    /// 受信フレームの角度のビット
+    static constexpr uint16_t ANGLE_MASK = 0x3FFFU;
+    /// 受信フレームのエラーフラグ (EF)
+    static constexpr uint16_t ERROR_FLAG = 0x4000U;
+    /// ANGLECOM (0x3FFF) の読み取りコマンド (bit14: 読み取り、bit15: 偶数パリティ)
+    static constexpr uint16_t READ_ANGLECOM = 0xFFFFU;
+    /// CS を下げてから SCK の最初のエッジまでの待ち (tL >= 350 ns、128 MHz で 45 サイクル以上)
+    static constexpr uint32_t CS_SETUP_NOPS = 48U;
+    /// 転送完了を待つ上限 [回] (通常は update() の時点で完了しているため待たない)
+    static constexpr uint32_t TRANSFER_WAIT_LIMIT = 1000U;
+    /// hardware_init() での同期読み取りのタイムアウト [ms]
+    static constexpr uint32_t TIMEOUT_MS = 10U;
+};
@@ -0,0 +1,89 @@
+/**
+ * @file board_traits.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief HTMDv2.2s のピン・タイマーチャネル割り当て
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#pragma once
+
+#include <cstdint>
+
+#include "main.h"
+#include "tim.h"
+
+/**
+ * @brief ボード固有のピン・タイマーチャネル割り当て
+ *
+ * 制御周期内のレジスタ直接アクセスはこの構造体経由で行い、
+ * ターゲットごとの差分をこのファイルに閉じ込める。
+ */
+struct BoardTraits {
+    // --- A3921 ---
+    static constexpr uint32_t DUTY_CHANNEL = TIM_CHANNEL_1;  ///< 可変デューティ (PWMH)
+    static constexpr uint32_t SR_CHANNEL   = TIM_CHANNEL_2;  ///< SR 制御用 (常に max_duty)
+    static constexpr uint16_t PHASE_PIN    = PHASE_Pin;
+    static constexpr uint16_t SR_PIN       = SR_Pin;
+
+    // --- リミットスイッチ ---
+    static constexpr uint16_t LIM1_PIN = LIM1_Pin;
+
+    // --- アブソリュートエンコーダ (SPI2) ---
+    static constexpr uint16_t ENCODER_CS_PIN = SPI2_CS_Pin;
+
+    // --- LED ---
+    static constexpr uint16_t LED_HEARTBEAT_PIN   = LED_LGC_PWR_Pin;  ///< 制御周期確認用
+    static constexpr uint16_t LED_INITIALIZED_PIN = LED_CAN_Pin;      ///< 初期化済み
+
+    /** @brief 可変デューティチャネルの比較レジスタ */
+    static volatile uint32_t& duty_compare()
+    {
+        return TIM2->CCR1;
+    }
+
+    /** @brief SR 制御チャネルの比較レジスタ */
+    static volatile uint32_t& sr_compare()
+    {
+        return TIM2->CCR2;
+    }
+
+    /** @brief PHASE ピンのポート */
+    static GPIO_TypeDef* phase_port()
+    {
+        return PHASE_GPIO_Port;
+    }
+
+    /** @brief SR ピンのポート */
+    static GPIO_TypeDef* sr_port()
+    {
+        return SR_GPIO_Port;
+    }
+
+    /** @brief LIM1 ピンのポート */
+    static GPIO_TypeDef* lim1_port()
+    {
+        return LIM1_GPIO_Port;
+    }
+
+    /** @brief アブソリュートエンコーダの CS ピンのポート */
+    static GPIO_TypeDef* encoder_cs_port()
+    {
+        return SPI2_CS_GPIO_Port;
+    }
+
+    /** @brief 制御周期確認用 LED のポート */
+    static GPIO_TypeDef* led_heartbeat_port()
+    {
+        return LED_LGC_PWR_GPIO_Port;
+    }
+
+    /** @brief 初期化済み LED のポート */
+    static GPIO_TypeDef* led_initialized_port()
+    {
+        return LED_CAN_GPIO_Port;
+    }
+};
@@ -0,0 +1,76 @@
+/**
+ * @file boot_profile.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief 起動時間の計測 (main() 先頭から各起動フェーズまでの経過時間)
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "gn10_motor/extension_protocol.hpp"
+
+/**
+ * @brief 起動フェーズの到達時刻を DWT サイクルカウンタで記録する
+ *
+ * SystemClock_Config() の前後でコアクロックが変わるため、ClockConfigured を基準点として
+ * 以降のフェーズは設定後のクロックで換算する。
+ * 各フェーズは自分の要素だけを書き込むため、タイマー割り込みとメインループから
+ * 別々のフェーズを記録しても競合しない (基準点は ClockConfigured でのみ変更する)。
+ *
+ * CYCCNT の桁あふれ (128MHz で約 33.5s) 以内に起動が終わる前提。
+ */
+class BootProfile
+{
+public:
+    using Phase = gn10_motor::extension::BootPhase;
+
+    BootProfile();
+
+    /**
+     * @brief サイクルカウンタを有効化して計測を開始する
+     *        main() の先頭 (HAL_Init() の前) で呼ぶこと
+     */
+    void start();
+
+    /**
+     * @brief 起動フェーズへの到達を記録する (2 回目以降は無視する)
+     * @param phase 起動フェーズ
+     */
+    void mark(Phase phase);
+
+    /**
+     * @brief 起動フェーズに到達済みかを返す
+     * @param phase 起動フェーズ
+     * @return true mark() で記録済み
+     */
+    bool reached(Phase phase) const
+    {
+        return reached_[static_cast<uint8_t>(phase)];
+    }
+
+    /**
+     * @brief 起動フェーズの到達時刻を返す
+     * @param phase 起動フェーズ
+     * @return uint32_t main() 先頭からの経過時間 [us] (未到達なら 0)
+     */
+    uint32_t elapsed_us(Phase phase) const
+    {
+        return elapsed_us_[static_cast<uint8_t>(phase)];
+    }
+
+private:
+    static constexpr uint8_t PHASE_COUNT = static_cast<uint8_t>(Phase::Count);
+
+    uint32_t base_cycles_;    ///< 換算の基準点の CYCCNT
+    uint32_t base_us_;        ///< 基準点の経過時間 [us]
+    uint32_t cycles_per_us_;  ///< 基準点以降のコアクロック [cycle/us]
+    std::array<uint32_t, PHASE_COUNT> elapsed_us_;
+    std::array<volatile bool, PHASE_COUNT> reached_;
+};
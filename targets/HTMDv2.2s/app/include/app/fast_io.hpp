@@ -0,0 +1,65 @@
+/**
+ * @file fast_io.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief 制御周期ごとに呼ばれる GPIO 操作のレジスタ直接アクセス版
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#pragma once
+
+#include <cstdint>
+
+#include "main.h"
+
+/**
+ * @brief HAL を経由しない GPIO アクセス関数群
+ *
+ * HAL_GPIO_* は引数チェックと関数呼び出しのオーバーヘッドがあるため、
+ * タイマー割り込み内で毎周期呼ぶ処理はこちらを使用する。
+ * F3 / G4 の GPIO_TypeDef は IDR / ODR / BSRR の構成が同一のため共通で使える。
+ */
+namespace fast_io {
+
+/**
+ * @brief BSRR への1回の書き込みでピン出力を設定する (read-modify-write なし)
+ * @param port  GPIO ポート
+ * @param pin   ピンマスク (GPIO_PIN_x)
+ * @param state true: High, false: Low
+ */
+inline void write_pin(GPIO_TypeDef* port, uint16_t pin, bool state)
+{
+    if (state) {
+        port->BSRR = pin;
+    } else {
+        port->BSRR = static_cast<uint32_t>(pin) << 16U;
+    }
+}
+
+/**
+ * @brief IDR をマスクしてピン入力を読み取る
+ * @param port GPIO ポート
+ * @param pin  ピンマスク (GPIO_PIN_x)
+ * @return true High
+ */
+inline bool read_pin(const GPIO_TypeDef* port, uint16_t pin)
+{
+    return (port->IDR & pin) != 0U;
+}
+
+/**
+ * @brief ピン出力を反転する
+ * @param port GPIO ポート
+ * @param pin  ピンマスク (GPIO_PIN_x)
+ */
+inline void toggle_pin(GPIO_TypeDef* port, uint16_t pin)
+{
+    // High のビットはリセット側、Low のビットはセット側に書き込む
+    const uint32_t odr = port->ODR;
+    port->BSRR         = ((odr & pin) << 16U) | (~odr & pin);
+}
+
+}  // namespace fast_io
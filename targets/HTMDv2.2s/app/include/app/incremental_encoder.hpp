@@ -37,6 +37,12 @@ public:
      */
     int16_t read_and_reset_count() override;
 
+    /**
+     * @brief カウンタをリセットせずに読み取る (リミットスイッチのエッジ割り込み用)
+     * @return int16_t 前回の read_and_reset_count() からの差分カウント
+     */
+    int16_t peek_count() const;
+
     /**
      * @brief カウント差分を角速度 [rad/s] に変換する
      * @param count  read_and_reset_count() の戻り値
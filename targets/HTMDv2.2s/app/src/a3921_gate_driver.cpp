@@ -14,18 +14,24 @@
 #include <algorithm>
 #include <cstdint>
 
+#include "app/board_traits.hpp"
+#include "app/fast_io.hpp"
 #include "gpio.h"
 #include "tim.h"
 
-A3921GateDriver::A3921GateDriver(uint16_t max_duty) : max_duty_(max_duty) {}
+A3921GateDriver::A3921GateDriver(uint16_t max_duty) : max_duty_(max_duty), forward_(true) {}
 
 void A3921GateDriver::hardware_init()
 {
     // PWM および GPIO の初期化
-    HAL_TIM_PWM_Start(&htim2, TIM_CHANNEL_1);
-    HAL_TIM_PWM_Start(&htim2, TIM_CHANNEL_2);
+    HAL_TIM_PWM_Start(&htim2, BoardTraits::DUTY_CHANNEL);
+    HAL_TIM_PWM_Start(&htim2, BoardTraits::SR_CHANNEL);
 
-    HAL_GPIO_WritePin(PHASE_GPIO_Port, PHASE_Pin, GPIO_PIN_SET);  // モーター回転方向: 正
+    // SR 制御用チャネルは常に max_duty_ のため、毎周期ではなくここで1回だけ設定する
+    BoardTraits::sr_compare() = max_duty_;
+
+    fast_io::write_pin(BoardTraits::phase_port(), BoardTraits::PHASE_PIN, true);  // 回転方向: 正
+    forward_ = true;
     set_brake(true);  // 自クラスの set_brake() 経由で統一する
 }
 
@@ -35,20 +41,21 @@ void A3921GateDriver::output(float output)
     output = std::clamp(output, -1.0f, 1.0f) * static_cast<float>(max_duty_);
 
     // 負値の場合は PHASE ピンで回転方向を切り替え、絶対値を使用する
-    if (output < 0.0f) {
-        HAL_GPIO_WritePin(PHASE_GPIO_Port, PHASE_Pin, GPIO_PIN_RESET);
+    const bool forward = (output >= 0.0f);
+    if (!forward) {
         output = -output;
-    } else {
-        HAL_GPIO_WritePin(PHASE_GPIO_Port, PHASE_Pin, GPIO_PIN_SET);
     }
 
-    // CH1: 可変デューティ, CH2: 常に max_duty_（A3921 の SR 制御用）
-    __HAL_TIM_SET_COMPARE(&htim2, TIM_CHANNEL_1, static_cast<uint32_t>(output));
-    __HAL_TIM_SET_COMPARE(&htim2, TIM_CHANNEL_2, max_duty_);
+    // PHASE ピンは方向が変わったときだけ書き込む
+    if (forward != forward_) {
+        fast_io::write_pin(BoardTraits::phase_port(), BoardTraits::PHASE_PIN, forward);
+        forward_ = forward;
+    }
+
+    BoardTraits::duty_compare() = static_cast<uint32_t>(output);
 }
 
 void A3921GateDriver::set_brake(bool brake)
 {
-    GPIO_PinState state = brake ? GPIO_PIN_SET : GPIO_PIN_RESET;
-    HAL_GPIO_WritePin(SR_GPIO_Port, SR_Pin, state);
-}
\ No newline at end of file
+    fast_io::write_pin(BoardTraits::sr_port(), BoardTraits::SR_PIN, brake);
+}
@@ -11,20 +11,32 @@
  */
 #include "app/app.hpp"
 
+#include <cmath>
 #include <cstdint>
 #include <optional>
 
 #include "app/a3921_gate_driver.hpp"
+#include "app/as5047_encoder.hpp"
+#include "app/board_traits.hpp"
+#include "app/boot_profile.hpp"
+#include "app/dwt_clock.hpp"
+#include "app/extension_can_port.hpp"
+#include "app/fast_io.hpp"
 #include "app/incremental_encoder.hpp"
 #include "app/mcp3421.hpp"
+#include "app/parameter_flash.hpp"
 #include "app/tmp275.hpp"
 #include "drivers/stm32_fdcan/driver_stm32_fdcan.hpp"
 #include "fdcan.h"
 #include "gn10_can/core/can_bus.hpp"
 #include "gn10_can/devices/motor_driver_server.hpp"
+#include "gn10_motor/extension_server.hpp"
 #include "gn10_motor/motor_controller.hpp"
+#include "gn10_motor/parameter_store.hpp"
 #include "gpio.h"
+#include "spi.h"
 #include "tim.h"
+#include "usart.h"
 
 // ---------------------------------------------------------------------------
 // ファイルローカル定数
@@ -37,12 +49,24 @@ constexpr uint16_t ENCODER_MAX_COUNT = 4096U;
 /// PWMタイマーのオートリロード値 (htim2.Period)
 constexpr uint16_t PWM_MAX_DUTY = 3199U;
 
-/// 制御周期 [s] (htim6: 64MHz / 64 / 1000 = 1kHz → 1ms)
+/// 制御周期 [s] (htim6: 128MHz / 128 / 1000 = 1kHz → 1ms)
 constexpr float CONTROL_DT_S = 0.001f;
 
 /// LED1 点滅間隔 [制御周期] (100 × 1ms = 100ms ごとにトグル)
 constexpr uint32_t LED1_BLINK_CYCLES = 100U;
 
+/// 電流・温度の読み取り間隔 [ms] (MCP3421 の変換レート 15 SPS より長くする)
+constexpr uint32_t AUX_MEASUREMENT_PERIOD_MS = 100U;
+
+/// MCP3421 の 1 LSB [V] (16-bit / PGA ×1)
+constexpr float MCP3421_VOLTS_PER_LSB = 62.5e-6f;
+
+/// 電流センス電圧から電流への換算 [A/V] (シャント 1mΩ × アンプ 50 倍を想定。基板の回路に合わせる)
+constexpr float CURRENT_SENSE_A_PER_V = 20.0f;
+
+/// TMP275 の 1 LSB [degC]
+constexpr float TMP275_DEGC_PER_LSB = 1.0f / 256.0f;
+
 // ---------------------------------------------------------------------------
 // App クラス (実装詳細 — 外部に公開しない)
 // ---------------------------------------------------------------------------
@@ -52,6 +76,8 @@ constexpr uint32_t LED1_BLINK_CYCLES = 100U;
  *
  * 生成順の依存関係:
  *   can_driver_ → can_bus_ → (setup時) can_server_ → motor_
+ *   extension_port_, clock_ → (setup時) extension_server_ → motor_
+ *   parameter_flash_ → parameter_store_ → motor_
  */
 class App
 {
@@ -59,9 +85,16 @@ public:
     App()
         : can_driver_(&hfdcan1),
           can_bus_(can_driver_),
+          extension_port_(hfdcan1),
           gate_driver_(PWM_MAX_DUTY),
           encoder_(ENCODER_MAX_COUNT),
-          led1_count_(0)
+          absolute_encoder_(hspi2),
+          parameter_store_(parameter_flash_),
+          led1_count_(0),
+          deferred_init_done_(false),
+          current_a_(NAN),
+          temperature_degc_(NAN),
+          last_aux_measurement_ms_(0U)
     {
     }
 
@@ -71,29 +104,67 @@ public:
      */
     void setup()
     {
+        boot_profile_.mark(BootProfile::Phase::PeripheralsInitialized);
+
         const uint8_t board_id = read_board_id();
 
         // CAN ドライバ初期化 (フィルタ設定 + 受信割り込み有効)
         can_driver_.init();
 
-        // ゲートドライバ・エンコーダ初期化
+        // ゲートドライバ・エンコーダ・ボード時刻初期化
         gate_driver_.hardware_init();
         encoder_.hardware_init();
-
-        // I2C センサー初期化
-        // tmp275_.init();
-        mcp3421_.init();
+        MX_SPI2_Init();
+        absolute_encoder_.hardware_init();
+        clock_.init();
 
         // 実行時パラメータが必要なオブジェクトを構築
         can_server_.emplace(can_bus_, board_id);
-        motor_.emplace(gate_driver_, encoder_, *can_server_);
+        extension_server_.emplace(board_id, extension_port_, clock_);
+        extension_port_.init(board_id);
+        motor_.emplace(
+            gate_driver_,
+            encoder_,
+            *can_server_,
+            *extension_server_,
+            parameter_store_,
+            &absolute_encoder_
+        );
+
+        // フラッシュに保存済みのパラメータがあればホストからの初期化を待たずに制御可能にする
+        motor_->load_parameters();
 
         // 制御タイマー (htim6) 割り込み開始
         HAL_TIM_Base_Start_IT(&htim6);
+        boot_profile_.mark(BootProfile::Phase::ControlStarted);
     }
 
-    /** @brief メインループ (全処理は割り込み駆動のため空) */
-    void loop() {}
+    /**
+     * @brief メインループ
+     *        制御は割り込み駆動のため、制御ループ起動後の遅延初期化と
+     *        I2C センサー (電流・温度) の読み取りだけを行う
+     */
+    void loop()
+    {
+        if (!deferred_init_done_) {
+            deferred_init();
+            deferred_init_done_ = true;
+            boot_profile_.mark(BootProfile::Phase::DeferredInitDone);
+        }
+        update_auxiliary_measurements();
+    }
+
+    /** @brief 起動時間の計測を開始する (main() の先頭から呼ばれる) */
+    void on_boot()
+    {
+        boot_profile_.start();
+    }
+
+    /** @brief システムクロックの設定完了を記録する */
+    void on_clock_configured()
+    {
+        boot_profile_.mark(BootProfile::Phase::ClockConfigured);
+    }
 
     /**
      * @brief CAN受信割り込みハンドラ
@@ -104,6 +175,24 @@ public:
         can_bus_.update();
     }
 
+    /**
+     * @brief 拡張コマンド受信割り込みハンドラ (Rx FIFO1)
+     *        位相合わせが有効なら Sync 受信時に制御周期の位相を揃える
+     */
+    void on_extension_rx(FDCAN_HandleTypeDef* /*hfdcan*/)
+    {
+        if (!extension_server_.has_value()) {
+            return;
+        }
+        extension_port_.on_rx_fifo1(*extension_server_);
+
+        // Sync 受信から一定時間後に制御周期が来るよう TIM6 のカウンタを揃え、
+        // バス上の全ボードの制御ループを同じ位相で動かす
+        if (extension_server_->get_phase_align_request()) {
+            __HAL_TIM_SET_COUNTER(&htim6, 0U);
+        }
+    }
+
     /**
      * @brief タイマー割り込みハンドラ (htim6 のみ処理)
      *        毎制御周期 (1ms) に MotorController と LED を更新する
@@ -114,14 +203,46 @@ public:
             return;
         }
 
-        // リミットスイッチ状態取得 (bit0 = LIM1)
-        const uint8_t limit_sw = HAL_GPIO_ReadPin(LIM1_GPIO_Port, LIM1_Pin) ? 1U : 0U;
+        // アブソリュートエンコーダの読み取りを先に始め、update() までに DMA 転送を終わらせる
+        absolute_encoder_.start_transfer();
 
-        motor_->update(CONTROL_DT_S, limit_sw);
+        motor_->update(CONTROL_DT_S, read_limit_switches());
         update_leds();
+
+        if (!boot_profile_.reached(BootProfile::Phase::FirstControlTick)) {
+            boot_profile_.mark(BootProfile::Phase::FirstControlTick);
+        }
+        report_boot_profile();
+    }
+
+    /**
+     * @brief リミットスイッチの EXTI 割り込みハンドラ
+     *        停止方向に出力中なら制御周期を待たずに出力を止め、エッジ時点の位置を記録する
+     *        (EXTI の優先度は htim6 と同じにし、update() の途中では呼ばれない)
+     * @param pin 割り込みが発生したピン (GPIO_PIN_x)
+     */
+    void on_limit_switch(uint16_t pin)
+    {
+        if (pin != BoardTraits::LIM1_PIN || !motor_.has_value()) {
+            return;
+        }
+        motor_->on_limit_switch_edge(read_limit_switches(), encoder_.peek_count());
     }
 
 private:
+    /**
+     * @brief リミットスイッチ状態を読み取る
+     * @return uint8_t リミットスイッチ状態 (bit0 = LIM1)
+     */
+    static uint8_t read_limit_switches()
+    {
+        uint8_t limit_sw = 0U;
+        if (fast_io::read_pin(BoardTraits::lim1_port(), BoardTraits::LIM1_PIN)) {
+            limit_sw |= 0b0001U;
+        }
+        return limit_sw;
+    }
+
     /**
      * @brief DIP スイッチを読み取りボード ID を返す
      *        DIP4=bit0(LSB), DIP3=bit1, DIP2=bit2, DIP1=bit3(MSB)
@@ -137,6 +258,59 @@ private:
         return id;
     }
 
+    /**
+     * @brief 制御に不要な周辺機能・センサを初期化する (メインループから1回だけ呼ぶ)
+     *        センサが未実装だと I2C のタイムアウト (100ms) まで待つため、
+     *        制御ループの起動を遅らせないよう setup() から外している
+     */
+    void deferred_init()
+    {
+        // I2C センサー初期化
+        MX_I2C1_Init();
+        tmp275_.init();
+        mcp3421_.init();
+
+        // 未使用の周辺機能 (CubeMX の設定に合わせて初期化だけ行う)
+        MX_USART3_UART_Init();
+    }
+
+    /**
+     * @brief 電流・温度を読み取り、拡張フィードバックで通知する値を更新する
+     *        (メインループから呼ぶ。I2C の読み取りは制御周期の割り込みを止めない)
+     *        読み取れなかった値は前回の値のまま (一度も読めなければ NaN) にする
+     */
+    void update_auxiliary_measurements()
+    {
+        const uint32_t now_ms = HAL_GetTick();
+        if (!motor_.has_value() || now_ms - last_aux_measurement_ms_ < AUX_MEASUREMENT_PERIOD_MS) {
+            return;
+        }
+        last_aux_measurement_ms_ = now_ms;
+
+        int16_t raw = 0;
+        if (mcp3421_.read(&raw)) {
+            current_a_ = static_cast<float>(raw) * MCP3421_VOLTS_PER_LSB * CURRENT_SENSE_A_PER_V;
+        }
+        if (tmp275_.read(&raw)) {
+            temperature_degc_ = static_cast<float>(raw) * TMP275_DEGC_PER_LSB;
+        }
+        motor_->set_auxiliary_measurements(current_a_, temperature_degc_);
+    }
+
+    /**
+     * @brief RequestBootProfile を受信していれば起動フェーズの到達時刻を返す
+     */
+    void report_boot_profile()
+    {
+        BootProfile::Phase phase = BootProfile::Phase::ClockConfigured;
+        if (!extension_server_->get_boot_profile_request(phase)) {
+            return;
+        }
+        extension_server_->send_boot_profile(
+            phase, boot_profile_.reached(phase), boot_profile_.elapsed_us(phase)
+        );
+    }
+
     /**
      * @brief LED 状態を更新する (タイマー割り込みから毎制御周期呼ぶ)
      *
@@ -152,13 +326,15 @@ private:
         // LED1: 100周期ごとにトグル
         ++led1_count_;
         if (led1_count_ >= LED1_BLINK_CYCLES) {
-            HAL_GPIO_TogglePin(LED_LGC_PWR_GPIO_Port, LED_LGC_PWR_Pin);
+            fast_io::toggle_pin(BoardTraits::led_heartbeat_port(), BoardTraits::LED_HEARTBEAT_PIN);
             led1_count_ = 0;
         }
 
         // LED4は初期化後点灯
         if (motor_->is_initialized()) {
-            HAL_GPIO_WritePin(LED_CAN_GPIO_Port, LED_CAN_Pin, GPIO_PIN_SET);
+            fast_io::write_pin(
+                BoardTraits::led_initialized_port(), BoardTraits::LED_INITIALIZED_PIN, true
+            );
         }
 
         if (!motor_.has_value()) {
@@ -169,17 +345,32 @@ private:
     // --- ハードウェア層 (コンストラクタで安全に生成できる) ---
     gn10_can::drivers::DriverSTM32FDCAN can_driver_;  ///< STM32 CAN ハードウェアドライバ
     gn10_can::CANBus can_bus_;                        ///< CAN バスルーター
+    ExtensionCANPort extension_port_;                 ///< 拡張コマンド送受信ポート
+    DWTClock clock_;                                  ///< ボード時刻 (DWT サイクルカウンタ)
     A3921GateDriver gate_driver_;                     ///< A3921 ゲートドライバ
     IncrementalEncoder encoder_;                      ///< インクリメンタルエンコーダ
+    AS5047Encoder absolute_encoder_;                  ///< アブソリュートエンコーダ (SPI2)
+    ParameterFlash parameter_flash_;                  ///< パラメータ保存用フラッシュ領域
+    gn10_motor::ParameterStore parameter_store_;      ///< 保存パラメータの読み書き
     TMP275 tmp275_{hi2c1};                            ///< TMP275 温度センサ
     MCP3421 mcp3421_{hi2c1};                          ///< MCP3421 電流センシング ADC
 
     // --- 実行時パラメータが必要なオブジェクト (setup() で emplace 構築) ---
     std::optional<gn10_can::devices::MotorDriverServer> can_server_;
+    std::optional<gn10_motor::ExtensionServer> extension_server_;
     std::optional<gn10_motor::MotorController> motor_;
 
     // --- LED 状態 ---
     uint32_t led1_count_;  ///< LED1 点滅カウンタ
+
+    // --- 起動処理 ---
+    BootProfile boot_profile_;  ///< 起動フェーズの到達時刻
+    bool deferred_init_done_;   ///< 遅延初期化が完了したか
+
+    // --- 補助計測値 (メインループで更新) ---
+    float current_a_;                   ///< モーター電流 [A] (未計測なら NaN)
+    float temperature_degc_;            ///< 基板温度 [degC] (未計測なら NaN)
+    uint32_t last_aux_measurement_ms_;  ///< 最後に読み取った時刻 [ms]
 };
 
 App gn10_app;
@@ -200,14 +391,34 @@ void loop()
     gn10_app.loop();
 }
 
+void boot_profile_start()
+{
+    gn10_app.on_boot();
+}
+
+void boot_profile_clock_configured()
+{
+    gn10_app.on_clock_configured();
+}
+
 extern "C" {
 void HAL_FDCAN_RxFifo0Callback(FDCAN_HandleTypeDef* hfdcan, uint32_t RxFifo0ITs)
 {
     gn10_app.on_can_rx(hfdcan);
 }
 
+void HAL_FDCAN_RxFifo1Callback(FDCAN_HandleTypeDef* hfdcan, uint32_t RxFifo1ITs)
+{
+    gn10_app.on_extension_rx(hfdcan);
+}
+
 void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef* htim)
 {
     gn10_app.on_timer(htim);
 }
+
+void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
+{
+    gn10_app.on_limit_switch(GPIO_Pin);
+}
 }  // extern "C"
@@ -0,0 +1,182 @@
+/**
+ * @file as5047_encoder.cpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief SPI2 + DMA で読み取る AS5047P アブソリュートエンコーダ
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#include "app/as5047_encoder.hpp"
+
+#include <cstdint>
+
+#include "app/board_traits.hpp"
+#include "app/fast_io.hpp"
+
+// 2π 定数 (M_PI は POSIX 拡張のため constexpr で定義)
+static constexpr float TWO_PI = 6.28318530f;
+
+AS5047Encoder::AS5047Encoder(SPI_HandleTypeDef& hspi)
+    : hspi_(hspi),
+      hdma_rx_{},
+      hdma_tx_{},
+      tx_frame_(READ_ANGLECOM),
+      rx_frame_(0U),
+      transfer_pending_(false),
+      last_angle_(0U),
+      total_count_(0)
+{
+}
+
+void AS5047Encoder::hardware_init()
+{
+    // 起動時は CS が Low のため、最初のフレームの前に High に戻す
+    fast_io::write_pin(BoardTraits::encoder_cs_port(), BoardTraits::ENCODER_CS_PIN, true);
+
+    __HAL_RCC_DMAMUX1_CLK_ENABLE();
+    __HAL_RCC_DMA1_CLK_ENABLE();
+
+    // 受信を DMA1 Channel1、送信を DMA1 Channel2 で行う (完了は受信側の TCIF1 で判定する)
+    init_dma_channel(hdma_rx_, DMA1_Channel1, DMA_REQUEST_SPI2_RX, DMA_PERIPH_TO_MEMORY);
+    init_dma_channel(hdma_tx_, DMA1_Channel2, DMA_REQUEST_SPI2_TX, DMA_MEMORY_TO_PERIPH);
+
+    // アドレスは転送ごとに変わらないため先に設定し、毎周期は転送数と有効化だけを書き込む
+    const auto address = [](volatile const void* pointer) {
+        return static_cast<uint32_t>(reinterpret_cast<uintptr_t>(pointer));
+    };
+    DMA1_Channel1->CPAR = address(&hspi_.Instance->DR);
+    DMA1_Channel1->CMAR = address(&rx_frame_);
+    DMA1_Channel2->CPAR = address(&hspi_.Instance->DR);
+    DMA1_Channel2->CMAR = address(&tx_frame_);
+
+    // 電源投入時の角度を読む (応答は次のフレームで返るため 2 回送る)
+    uint16_t frame = 0U;
+    for (int i = 0; i < 2; ++i) {
+        fast_io::write_pin(BoardTraits::encoder_cs_port(), BoardTraits::ENCODER_CS_PIN, false);
+        HAL_SPI_TransmitReceive(
+            &hspi_,
+            reinterpret_cast<uint8_t*>(&tx_frame_),
+            reinterpret_cast<uint8_t*>(&frame),
+            1U,
+            TIMEOUT_MS
+        );
+        fast_io::write_pin(BoardTraits::encoder_cs_port(), BoardTraits::ENCODER_CS_PIN, true);
+    }
+    if (is_valid_frame(frame)) {
+        last_angle_ = frame & ANGLE_MASK;
+    }
+    total_count_ = last_angle_;
+
+    // 以降は DMA リクエストで送受信する (SPI は有効のまま、DMA チャネルの有効化で転送を始める)
+    SET_BIT(hspi_.Instance->CR2, SPI_CR2_RXDMAEN | SPI_CR2_TXDMAEN);
+    __HAL_SPI_ENABLE(&hspi_);
+}
+
+void AS5047Encoder::start_transfer()
+{
+    // 前の周期の結果を受け取っていなければ (Absolute 以外で制御中)、角度だけ更新して差分は捨てる
+    // reset() で 1 回転内の絶対角度に戻したとき、最新の角度を使えるようにするため
+    if (transfer_pending_) {
+        read_and_reset_count();
+    }
+
+    fast_io::write_pin(BoardTraits::encoder_cs_port(), BoardTraits::ENCODER_CS_PIN, false);
+    DMA1->IFCR           = DMA_IFCR_CGIF1 | DMA_IFCR_CGIF2;
+    DMA1_Channel1->CNDTR = 1U;
+    DMA1_Channel2->CNDTR = 1U;
+    for (uint32_t i = 0; i < CS_SETUP_NOPS; ++i) {
+        __NOP();
+    }
+
+    // 受信側を先に有効にする。送信側を有効にすると TXE のリクエストで即座にフレームが始まる
+    DMA1_Channel1->CCR |= DMA_CCR_EN;
+    DMA1_Channel2->CCR |= DMA_CCR_EN;
+    transfer_pending_ = true;
+}
+
+int16_t AS5047Encoder::read_and_reset_count()
+{
+    if (!transfer_pending_ || !finish_transfer()) {
+        return 0;
+    }
+
+    const uint16_t frame = rx_frame_;
+    if (!is_valid_frame(frame)) {
+        return 0;
+    }
+
+    // 1 回転内の角度の差分を ±半回転に折り返す (1 周期で半回転以上は回らない前提)
+    const uint16_t angle = frame & ANGLE_MASK;
+    int32_t delta        = static_cast<int32_t>(angle) - static_cast<int32_t>(last_angle_);
+    if (delta >= COUNTS_PER_REV / 2) {
+        delta -= COUNTS_PER_REV;
+    } else if (delta < -COUNTS_PER_REV / 2) {
+        delta += COUNTS_PER_REV;
+    }
+    last_angle_ = angle;
+    return static_cast<int16_t>(delta);
+}
+
+float AS5047Encoder::count_to_angular_velocity(int16_t count, float period_s)
+{
+    return static_cast<float>(count) / static_cast<float>(COUNTS_PER_REV) * TWO_PI / period_s;
+}
+
+float AS5047Encoder::accumulate_angle_rad(int16_t count)
+{
+    // float の積算では誤差が蓄積するため、カウントで積算してから変換する
+    total_count_ += count;
+    return static_cast<float>(total_count_) / static_cast<float>(COUNTS_PER_REV) * TWO_PI;
+}
+
+void AS5047Encoder::reset()
+{
+    total_count_ = last_angle_;
+}
+
+void AS5047Encoder::init_dma_channel(
+    DMA_HandleTypeDef& hdma, DMA_Channel_TypeDef* channel, uint32_t request, uint32_t direction
+)
+{
+    hdma.Instance                 = channel;
+    hdma.Init.Request             = request;
+    hdma.Init.Direction           = direction;
+    hdma.Init.PeriphInc           = DMA_PINC_DISABLE;
+    hdma.Init.MemInc              = DMA_MINC_DISABLE;
+    hdma.Init.PeriphDataAlignment = DMA_PDATAALIGN_HALFWORD;
+    hdma.Init.MemDataAlignment    = DMA_MDATAALIGN_HALFWORD;
+    hdma.Init.Mode                = DMA_NORMAL;
+    hdma.Init.Priority            = DMA_PRIORITY_HIGH;
+    HAL_DMA_Init(&hdma);
+}
+
+bool AS5047Encoder::is_valid_frame(uint16_t frame)
+{
+    // bit15 は bit14:0 の偶数パリティ (16-bit 全体の 1 の数が偶数なら正常)
+    uint16_t parity = frame;
+    parity ^= parity >> 8U;
+    parity ^= parity >> 4U;
+    parity ^= parity >> 2U;
+    parity ^= parity >> 1U;
+    return ((parity & 1U) == 0U) && ((frame & ERROR_FLAG) == 0U);
+}
+
+bool AS5047Encoder::finish_transfer()
+{
+    transfer_pending_ = false;
+
+    // 受信チャネルの転送完了 = フレームの最後のビットまで受信済み
+    uint32_t wait = 0U;
+    while ((DMA1->ISR & DMA_ISR_TCIF1) == 0U && wait < TRANSFER_WAIT_LIMIT) {
+        ++wait;
+    }
+    const bool done = (DMA1->ISR & DMA_ISR_TCIF1) != 0U;
+
+    fast_io::write_pin(BoardTraits::encoder_cs_port(), BoardTraits::ENCODER_CS_PIN, true);
+    DMA1_Channel1->CCR &= ~DMA_CCR_EN;
+    DMA1_Channel2->CCR &= ~DMA_CCR_EN;
+    return done;
+}
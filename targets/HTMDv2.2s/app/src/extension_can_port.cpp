@@ -0,0 +1,132 @@
+/**
+ * @file extension_can_port.cpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief 拡張コマンド用 CAN 送受信ポート (FDCAN)
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#include "app/extension_can_port.hpp"
+
+#include <cstring>
+
+#include "gn10_motor/can_acceptance.hpp"
+#include "gn10_motor/extension_protocol.hpp"
+
+namespace {
+
+/// DLC コード (0-15) に対応するデータ長 [byte]
+constexpr uint8_t DLC_TO_LENGTH[16] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64};
+
+/**
+ * @brief データ長を格納できる最小の DLC コードを返す
+ * @param length データ長 [byte] (64 以下)
+ * @return uint32_t DLC コード (FDCAN_DLC_BYTES_x と同値)
+ */
+uint32_t length_to_dlc(uint8_t length)
+{
+    uint32_t dlc = 0U;
+    while (DLC_TO_LENGTH[dlc] < length) {
+        ++dlc;
+    }
+    return dlc;
+}
+
+}  // namespace
+
+ExtensionCANPort::ExtensionCANPort(FDCAN_HandleTypeDef& hfdcan) : hfdcan_(hfdcan) {}
+
+void ExtensionCANPort::init(uint8_t board_id)
+{
+    // グローバルフィルタは初期化モードでしか変更できないため、CAN ドライバが
+    // 通信を開始済みなら一旦停止して設定する
+    const bool started = (HAL_FDCAN_GetState(&hfdcan_) == HAL_FDCAN_STATE_BUSY);
+    if (started) {
+        HAL_FDCAN_Stop(&hfdcan_);
+    }
+
+    // フィルタは番号の小さい順に評価され、最初に一致したもので処理が決まる
+    // [0] 自ボード宛て拡張コマンドとブロードキャスト → Rx FIFO1
+    FDCAN_FilterTypeDef filter = {};
+    filter.IdType              = FDCAN_STANDARD_ID;
+    filter.FilterIndex         = EXTENSION_FILTER_INDEX;
+    filter.FilterType          = FDCAN_FILTER_DUAL;
+    filter.FilterConfig        = FDCAN_FILTER_TO_RXFIFO1;
+    filter.FilterID1           = gn10_motor::extension::command_id(board_id);
+    filter.FilterID2           = gn10_motor::extension::BROADCAST_ID;
+    HAL_FDCAN_ConfigFilter(&hfdcan_, &filter);
+
+    // [1] それ以外の拡張プロトコル ID 帯 (他ボード宛て・他ボードの応答) → 破棄
+    filter.FilterIndex  = EXTENSION_REJECT_FILTER_INDEX;
+    filter.FilterType   = FDCAN_FILTER_MASK;
+    filter.FilterConfig = FDCAN_FILTER_REJECT;
+    filter.FilterID1    = gn10_motor::can_acceptance::EXTENSION_RANGE.id;
+    filter.FilterID2    = gn10_motor::can_acceptance::EXTENSION_RANGE.mask;
+    HAL_FDCAN_ConfigFilter(&hfdcan_, &filter);
+
+    // [2] 自ボード宛て gn10_can フレーム → Rx FIFO0 (CAN ドライバ)
+    const auto own = gn10_motor::can_acceptance::gn10_can_filter(board_id);
+    filter.FilterIndex  = GN10_CAN_FILTER_INDEX;
+    filter.FilterType   = FDCAN_FILTER_MASK;
+    filter.FilterConfig = FDCAN_FILTER_TO_RXFIFO0;
+    filter.FilterID1    = own.id;
+    filter.FilterID2    = own.mask;
+    HAL_FDCAN_ConfigFilter(&hfdcan_, &filter);
+
+    // どのフィルタにも一致しないフレームとリモートフレームはハードウェアで破棄し、
+    // 他ノードの通信量に関わらず受信割り込みを自ボード宛てのフレームに限定する
+    HAL_FDCAN_ConfigGlobalFilter(
+        &hfdcan_, FDCAN_REJECT, FDCAN_REJECT, FDCAN_REJECT_REMOTE, FDCAN_REJECT_REMOTE
+    );
+
+    if (started) {
+        HAL_FDCAN_Start(&hfdcan_);
+    }
+
+    HAL_FDCAN_ActivateNotification(&hfdcan_, FDCAN_IT_RX_FIFO1_NEW_MESSAGE, 0);
+}
+
+void ExtensionCANPort::on_rx_fifo1(gn10_motor::ExtensionServer& server)
+{
+    FDCAN_RxHeaderTypeDef header;
+    uint8_t data[gn10_motor::extension::FD_PAYLOAD_LENGTH];
+    while (HAL_FDCAN_GetRxFifoFillLevel(&hfdcan_, FDCAN_RX_FIFO1) > 0U) {
+        if (HAL_FDCAN_GetRxMessage(&hfdcan_, FDCAN_RX_FIFO1, &header, data) != HAL_OK) {
+            return;
+        }
+        server.on_receive(header.Identifier, data, DLC_TO_LENGTH[header.DataLength & 0x0FU]);
+    }
+}
+
+bool ExtensionCANPort::send(uint32_t id, const uint8_t* data, uint8_t length)
+{
+    if (length > gn10_motor::extension::FD_PAYLOAD_LENGTH) {
+        return false;
+    }
+
+    // 8 byte 以下はクラシック CAN で送り、非 FD ノードとの共存を保つ
+    const bool use_fd = length > gn10_motor::extension::CLASSIC_PAYLOAD_LENGTH;
+
+    FDCAN_TxHeaderTypeDef header = {};
+    header.Identifier            = id;
+    header.IdType                = FDCAN_STANDARD_ID;
+    header.TxFrameType           = FDCAN_DATA_FRAME;
+    header.DataLength            = length_to_dlc(length);
+    header.ErrorStateIndicator   = FDCAN_ESI_ACTIVE;
+    header.BitRateSwitch         = FDCAN_BRS_OFF;
+    header.FDFormat              = FDCAN_CLASSIC_CAN;
+    header.TxEventFifoControl    = FDCAN_NO_TX_EVENTS;
+    header.MessageMarker         = 0U;
+    if (use_fd) {
+        header.BitRateSwitch = FDCAN_BRS_ON;
+        header.FDFormat      = FDCAN_FD_CAN;
+    }
+
+    // DLC の刻みに合わせて末尾を 0 で埋める
+    uint8_t payload[gn10_motor::extension::FD_PAYLOAD_LENGTH] = {};
+    std::memcpy(payload, data, length);
+    return HAL_FDCAN_AddMessageToTxFifoQ(&hfdcan_, &header, payload) == HAL_OK;
+}
@@ -38,6 +38,11 @@ int16_t IncrementalEncoder::read_and_reset_count()
     return static_cast<int16_t>(raw);
 }
 
+int16_t IncrementalEncoder::peek_count() const
+{
+    return static_cast<int16_t>(TIM1->CNT);
+}
+
 float IncrementalEncoder::count_to_rad(int16_t count) const
 {
     return static_cast<float>(count) / static_cast<float>(max_count_) * TWO_PI;
@@ -0,0 +1,89 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: Apache-2.0
+"""Cortex-M4 (QEMU mps2-an386) で gn10_motor_bench の各処理の 1 回あたりの命令数を数える。
+
+QEMU の TCG プラグイン (libinsn.so) で実行命令数を数え、呼び出し回数を変えた 2 回の実行の
+差から setup() や起動処理の分を除いた 1 回あたりの命令数を求める。
+
+使い方:
+    cmake --preset qemu-m4
+    cmake --build --preset qemu-m4
+    python3 tools/bench/count_instructions.py build/qemu-m4/tools/bench/gn10_motor_bench.elf \\
+        --plugin /path/to/libinsn.so
+
+命令数は CPI = 1 とした場合のサイクル数の下限の目安である。実機ではフラッシュのウェイトや
+分岐・除算・ロードのストールで増えるため、制御周期に対する割合は余裕を持って判断すること。
+"""
+
+import argparse
+import re
+import subprocess
+import sys
+
+# 1 制御周期 [us] (htim6: 1kHz)
+CONTROL_PERIOD_US = 1000.0
+
+# コアクロック [MHz] (全ボード共通)
+CORE_CLOCK_MHZ = 64.0
+
+# 命令数の差を取る 2 回の呼び出し回数
+SMALL_ITERATIONS = 100
+LARGE_ITERATIONS = 1100
+
+INSN_PATTERN = re.compile(r"insns:\s*(\d+)")
+
+
+def run_qemu(args, bench_args):
+    """QEMU で gn10_motor_bench を実行し、標準出力と実行命令数を返す。"""
+    semihosting_args = ",".join("arg=" + a for a in ["gn10_motor_bench"] + bench_args)
+    command = [
+        args.qemu,
+        "-M", "mps2-an386",
+        "-nographic",
+        "-monitor", "none",
+        "-semihosting-config", "enable=on,target=native," + semihosting_args,
+        "-kernel", args.elf,
+    ]
+    if args.plugin:
+        command += ["-plugin", args.plugin + ",inline=on", "-d", "plugin"]
+    result = subprocess.run(command, capture_output=True, text=True, timeout=args.timeout)
+    if result.returncode != 0:
+        sys.exit(f"qemu failed ({result.returncode}):\n{result.stdout}{result.stderr}")
+
+    match = INSN_PATTERN.search(result.stderr) or INSN_PATTERN.search(result.stdout)
+    insns = int(match.group(1)) if match else None
+    return result.stdout, insns
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("elf", help="qemu-m4 プリセットでビルドした gn10_motor_bench.elf")
+    parser.add_argument("--plugin", required=True, help="QEMU の libinsn.so のパス")
+    parser.add_argument("--qemu", default="qemu-system-arm", help="qemu-system-arm のパス")
+    parser.add_argument("--kernel", action="append", help="対象の処理 (省略時は全て)")
+    parser.add_argument("--timeout", type=float, default=120.0, help="1 回の実行の制限時間 [s]")
+    args = parser.parse_args()
+
+    kernels = args.kernel
+    if not kernels:
+        stdout, _ = run_qemu(args, ["--list"])
+        kernels = [line.split()[0] for line in stdout.splitlines() if line.strip()]
+
+    print(f"{'kernel':<20} {'insns/call':>12} {'us@' + str(int(CORE_CLOCK_MHZ)) + 'MHz':>10}"
+          f" {'% of 1ms':>9}")
+    for kernel in kernels:
+        counts = []
+        for iterations in (SMALL_ITERATIONS, LARGE_ITERATIONS):
+            _, insns = run_qemu(args, ["--kernel", kernel, "--iterations", str(iterations)])
+            if insns is None:
+                sys.exit("instruction count not found in QEMU output (check --plugin)")
+            counts.append(insns)
+
+        per_call = (counts[1] - counts[0]) / (LARGE_ITERATIONS - SMALL_ITERATIONS)
+        per_call_us = per_call / CORE_CLOCK_MHZ
+        print(f"{kernel:<20} {per_call:>12.1f} {per_call_us:>10.2f}"
+              f" {100.0 * per_call_us / CONTROL_PERIOD_US:>8.2f}%")
+
+
+if __name__ == "__main__":
+    main()
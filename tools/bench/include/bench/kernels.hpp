@@ -0,0 +1,46 @@
+/**
+ * @file kernels.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief ベンチマーク対象の処理 (ホスト実行と Cortex-M4 シミュレータ実行で共通)
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace bench {
+
+/**
+ * @brief ベンチマーク対象の処理
+ *
+ * setup() で状態を初期化し、run() で対象の処理を iterations 回呼ぶ。
+ * 1 回あたりのコストは run() 全体を iterations で割って求めるため、
+ * run() のループ内では対象の処理と入力の更新以外を行わないこと。
+ */
+struct Kernel {
+    const char* name;  ///< コマンドラインで指定する名前
+    void (*setup)();
+    void (*run)(uint32_t iterations);
+};
+
+/**
+ * @brief 登録済みの処理の一覧を返す
+ * @param count 処理の数の格納先
+ * @return const Kernel* 先頭要素
+ */
+const Kernel* kernels(std::size_t& count);
+
+/**
+ * @brief 名前から処理を探す
+ * @param name 処理の名前
+ * @return const Kernel* 見つからなければ nullptr
+ */
+const Kernel* find_kernel(const char* name);
+
+}  // namespace bench
@@ -0,0 +1,76 @@
+/**
+ * @file startup.cpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief QEMU mps2-an386 (Cortex-M4) 用のベクタテーブルとリセットハンドラ
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * .data の初期化・.bss のゼロクリア・コマンドライン引数の取得・静的コンストラクタの呼び出しは
+ * newlib の rdimon (semihosting) の _start が行う。ここでは FPU を有効化して _start へ渡すだけ。
+ */
+#include <cstddef>
+#include <cstdint>
+
+extern "C" {
+/// rdimon-crt0 のエントリポイント
+void _start();
+
+/// スタックの先頭 (リンカスクリプトで定義)
+extern uint32_t __stack;
+
+[[noreturn]] void Reset_Handler();
+[[noreturn]] void Default_Handler();
+}
+
+namespace {
+
+/// コプロセッサアクセス制御レジスタ (SCB->CPACR)
+volatile uint32_t* const CPACR = reinterpret_cast<volatile uint32_t*>(0xE000ED88U);
+
+/// CP10・CP11 (FPU) のフルアクセス許可
+constexpr uint32_t CPACR_FPU_FULL_ACCESS = 0xFU << 20U;
+
+/// ベクタテーブルの要素数 (初期 SP + 例外 15 個。外部割り込みは使わない)
+constexpr std::size_t VECTOR_COUNT = 16U;
+
+}  // namespace
+
+extern "C" [[noreturn]] void Reset_Handler()
+{
+    // -mfloat-abi=hard でビルドしているため、浮動小数点命令より先に FPU を有効化する
+    *CPACR |= CPACR_FPU_FULL_ACCESS;
+    __asm volatile("dsb\n\tisb" ::: "memory");
+
+    _start();
+    while (true) {
+    }
+}
+
+extern "C" [[noreturn]] void Default_Handler()
+{
+    while (true) {
+    }
+}
+
+/// ベクタテーブル (リンカスクリプトで 0x00000000 に配置する)
+__attribute__((section(".isr_vector"), used)) void (*const vector_table[VECTOR_COUNT])() = {
+    reinterpret_cast<void (*)()>(&__stack),
+    Reset_Handler,
+    Default_Handler,  // NMI
+    Default_Handler,  // HardFault
+    Default_Handler,  // MemManage
+    Default_Handler,  // BusFault
+    Default_Handler,  // UsageFault
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    Default_Handler,  // SVCall
+    Default_Handler,  // DebugMonitor
+    nullptr,
+    Default_Handler,  // PendSV
+    Default_Handler,  // SysTick
+};
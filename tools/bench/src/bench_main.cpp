@@ -0,0 +1,125 @@
+/**
+ * @file bench_main.cpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief gn10_motor のベンチマークのエントリポイント
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * 使い方:
+ *   gn10_motor_bench                         全処理の 1 回あたりの時間を表示する
+ *   gn10_motor_bench --list                  処理の一覧を表示する
+ *   gn10_motor_bench --kernel <name> [--iterations <n>]
+ *                                            指定した処理だけを n 回実行する
+ *                                            (Cortex-M4 シミュレータで命令数を数えるときに使う)
+ */
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "bench/kernels.hpp"
+
+#ifdef GN10_BENCH_HOST_CLOCK
+#include <chrono>
+#endif
+
+namespace {
+
+/// 既定の呼び出し回数
+constexpr uint32_t DEFAULT_ITERATIONS = 100000U;
+
+/// 計測前のウォームアップ回数 (キャッシュ・分岐予測を安定させる)
+constexpr uint32_t WARMUP_ITERATIONS = 1000U;
+
+void print_usage(const char* program)
+{
+    std::printf("usage: %s [--list] [--kernel <name>] [--iterations <n>]\n", program);
+}
+
+void list_kernels()
+{
+    std::size_t count      = 0;
+    const bench::Kernel* k = bench::kernels(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        std::printf("%s\n", k[i].name);
+    }
+}
+
+/**
+ * @brief 処理を 1 つ実行し、ホストでは 1 回あたりの時間を表示する
+ * @param kernel     対象の処理
+ * @param iterations 呼び出し回数
+ * @param warmup     計測前にウォームアップするか
+ */
+void run_kernel(const bench::Kernel& kernel, uint32_t iterations, bool warmup)
+{
+    kernel.setup();
+    if (warmup) {
+        kernel.run(WARMUP_ITERATIONS);
+    }
+
+#ifdef GN10_BENCH_HOST_CLOCK
+    const auto start = std::chrono::steady_clock::now();
+    kernel.run(iterations);
+    const auto end = std::chrono::steady_clock::now();
+
+    const double total_ns = std::chrono::duration<double, std::nano>(end - start).count();
+    double per_call_ns    = 0.0;
+    if (iterations > 0U) {
+        per_call_ns = total_ns / static_cast<double>(iterations);
+    }
+    std::printf(
+        "%-20s %10.1f ns/call  (%lu calls)\n",
+        kernel.name,
+        per_call_ns,
+        static_cast<unsigned long>(iterations)
+    );
+#else
+    kernel.run(iterations);
+    std::printf("%-20s %lu calls\n", kernel.name, static_cast<unsigned long>(iterations));
+#endif
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    const char* kernel_name = nullptr;
+    uint32_t iterations     = DEFAULT_ITERATIONS;
+
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--list") == 0) {
+            list_kernels();
+            return EXIT_SUCCESS;
+        }
+        if (std::strcmp(argv[i], "--kernel") == 0 && i + 1 < argc) {
+            kernel_name = argv[++i];
+        } else if (std::strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+            iterations = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else {
+            print_usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    // 単体実行: 命令数の差分を取るため、ウォームアップせず指定回数だけ実行する
+    if (kernel_name != nullptr) {
+        const bench::Kernel* kernel = bench::find_kernel(kernel_name);
+        if (kernel == nullptr) {
+            std::printf("unknown kernel: %s\n", kernel_name);
+            return EXIT_FAILURE;
+        }
+        run_kernel(*kernel, iterations, false);
+        return EXIT_SUCCESS;
+    }
+
+    std::size_t count      = 0;
+    const bench::Kernel* k = bench::kernels(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        run_kernel(k[i], iterations, true);
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,388 @@
+/**
+ * @file kernels.cpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief ベンチマーク対象の処理の実装
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#include "bench/kernels.hpp"
+
+#include <array>
+#include <cstring>
+#include <optional>
+
+#include "gn10_motor/acceleration_limiter.hpp"
+#include "gn10_motor/backlash.hpp"
+#include "gn10_motor/biquad.hpp"
+#include "gn10_motor/disturbance_observer.hpp"
+#include "gn10_motor/friction_map.hpp"
+#include "gn10_motor/input_shaper.hpp"
+#include "gn10_motor/jerk_limiter.hpp"
+#include "gn10_motor/pid.hpp"
+#include "gn10_motor/tracking_observer.hpp"
+#include "host_common/motor_rig.hpp"
+
+namespace bench {
+
+namespace {
+
+/// 制御周期 [s] (実機の htim6 と同じ 1ms)
+constexpr float CONTROL_DT_S = 0.001f;
+
+/// 入力を変化させる周期 [回] (分岐予測やクランプの片側だけを測らないよう正負に振る)
+constexpr uint32_t INPUT_PERIOD = 64U;
+
+/// 結果を捨てさせないための書き込み先
+volatile float sink_float   = 0.0f;
+volatile double sink_double = 0.0;
+
+/**
+ * @brief 呼び出し回数から周期的に変化する入力を返す ([-1, 1] の三角波)
+ * @param i 呼び出し回数
+ * @return float 入力値
+ */
+float triangle(uint32_t i)
+{
+    const float phase = static_cast<float>(i % INPUT_PERIOD) / static_cast<float>(INPUT_PERIOD);
+    if (phase < 0.5f) {
+        return 4.0f * phase - 1.0f;
+    }
+    return 3.0f - 4.0f * phase;
+}
+
+// ---------------------------------------------------------------------------
+// PID
+// ---------------------------------------------------------------------------
+
+template <typename T>
+gn10_motor::PIDConfig<T> pid_config()
+{
+    gn10_motor::PIDConfig<T> config;
+    config.kp             = T{0.8};
+    config.ki             = T{0.05};
+    config.kd             = T{0.01};
+    config.integral_limit = T{0.3};
+    config.output_limit   = T{1.0};
+    return config;
+}
+
+gn10_motor::PID<float> pid_f(pid_config<float>());
+gn10_motor::PID<double> pid_d(pid_config<double>());
+
+void setup_pid_float()
+{
+    pid_f.reset();
+}
+
+void run_pid_float(uint32_t iterations)
+{
+    for (uint32_t i = 0; i < iterations; ++i) {
+        sink_float = pid_f.update(triangle(i), 0.0f, CONTROL_DT_S);
+    }
+}
+
+void setup_pid_double()
+{
+    pid_d.reset();
+}
+
+void run_pid_double(uint32_t iterations)
+{
+    for (uint32_t i = 0; i < iterations; ++i) {
+        sink_double = pid_d.update(static_cast<double>(triangle(i)), 0.0, CONTROL_DT_S);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// AccelerationLimiter
+// ---------------------------------------------------------------------------
+
+/// 加速度上限 [/s] (accel_ratio = 0.02 相当。三角波の変化より遅く、常に制限がかかる)
+constexpr float LIMITER_MAX_ACCEL = 20.0f;
+
+gn10_motor::AccelerationLimiter<float> limiter(LIMITER_MAX_ACCEL);
+
+void setup_limiter()
+{
+    limiter.reset();
+}
+
+void run_limiter(uint32_t iterations)
+{
+    for (uint32_t i = 0; i < iterations; ++i) {
+        sink_float = limiter.update(triangle(i), CONTROL_DT_S);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// JerkLimiter
+// ---------------------------------------------------------------------------
+
+/// 減速側の上限 [/s] (加速側の 2 倍。三角波の折り返しで加速・減速の両方を通る)
+constexpr float LIMITER_MAX_DECEL = 40.0f;
+
+/// 躍度の上限 [/s^2] (10 ms で 0 → LIMITER_MAX_ACCEL)
+constexpr float LIMITER_MAX_JERK = 2000.0f;
+
+gn10_motor::JerkLimiter<float> jerk_limiter(LIMITER_MAX_ACCEL, LIMITER_MAX_DECEL, LIMITER_MAX_JERK);
+
+void setup_jerk_limiter()
+{
+    jerk_limiter.reset();
+}
+
+void run_jerk_limiter(uint32_t iterations)
+{
+    for (uint32_t i = 0; i < iterations; ++i) {
+        sink_float = jerk_limiter.update(triangle(i), CONTROL_DT_S);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// TrackingObserver
+// ---------------------------------------------------------------------------
+
+/// 推定の帯域 [rad/s]
+constexpr float OBSERVER_BANDWIDTH_RAD_S = 300.0f;
+
+/// デューティ 1.0 あたりの角加速度 [rad/s^2]
+constexpr float OBSERVER_INPUT_GAIN = 2000.0f;
+
+/// 1 制御周期あたりの位置の変化の振幅 [rad] (約 50 rad/s)
+constexpr float OBSERVER_DELTA_AMPLITUDE = 0.05f;
+
+gn10_motor::TrackingObserver<float> observer(OBSERVER_BANDWIDTH_RAD_S, OBSERVER_INPUT_GAIN);
+
+void setup_observer()
+{
+    observer.reset();
+}
+
+void run_observer(uint32_t iterations)
+{
+    for (uint32_t i = 0; i < iterations; ++i) {
+        const float wave = triangle(i);
+        sink_float       = observer.update(wave * OBSERVER_DELTA_AMPLITUDE, CONTROL_DT_S, wave);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// BiquadCascade
+// ---------------------------------------------------------------------------
+
+/// ノッチの中心周波数 [Hz] と Q (軸の共振を想定)
+constexpr gn10_motor::BiquadConfig NOTCH_STAGE = {gn10_motor::BiquadType::Notch, 120.0f, 2.0f};
+
+/// ローパスの遮断周波数 [Hz] と Q (バターワース)
+constexpr gn10_motor::BiquadConfig LOW_PASS_STAGE = {
+    gn10_motor::BiquadType::LowPass, 200.0f, 0.707f
+};
+
+gn10_motor::BiquadCascade<float, 2> biquad;
+
+void setup_biquad()
+{
+    biquad.set_stage(0, NOTCH_STAGE);
+    biquad.set_stage(1, LOW_PASS_STAGE);
+    biquad.reset();
+}
+
+void run_biquad(uint32_t iterations)
+{
+    for (uint32_t i = 0; i < iterations; ++i) {
+        sink_float = biquad.update(triangle(i), CONTROL_DT_S);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// DisturbanceObserver
+// ---------------------------------------------------------------------------
+
+/// Q フィルタの遮断角周波数 [rad/s]
+constexpr float DISTURBANCE_CUTOFF_RAD_S = 50.0f;
+
+/// デューティ 1.0 あたりの角加速度 [rad/s^2] と機械的時定数 [s] (MotorPlant の既定値と同じ)
+constexpr float DISTURBANCE_GAIN_RAD_S2     = 1200.0f;
+constexpr float DISTURBANCE_TIME_CONSTANT_S = 0.05f;
+
+/// 角速度の振幅 [rad/s]
+constexpr float DISTURBANCE_VELOCITY_AMPLITUDE = 50.0f;
+
+gn10_motor::DisturbanceObserver<float> disturbance_observer;
+
+void setup_disturbance_observer()
+{
+    disturbance_observer.configure(
+        DISTURBANCE_CUTOFF_RAD_S, DISTURBANCE_GAIN_RAD_S2, DISTURBANCE_TIME_CONSTANT_S
+    );
+    disturbance_observer.reset();
+}
+
+void run_disturbance_observer(uint32_t iterations)
+{
+    for (uint32_t i = 0; i < iterations; ++i) {
+        const float wave     = triangle(i);
+        const float velocity = wave * DISTURBANCE_VELOCITY_AMPLITUDE;
+        sink_float           = disturbance_observer.update(wave, velocity, CONTROL_DT_S);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// InputShaper
+// ---------------------------------------------------------------------------
+
+/// 振動モード 10 Hz・減衰比 0.05 の ZVD (遅れ約 100 サンプル)
+constexpr gn10_motor::InputShaperConfig SHAPER_CONFIG = {
+    gn10_motor::InputShaperType::ZVD, 10.0f, 0.05f
+};
+
+gn10_motor::InputShaper<float, gn10_motor::SHAPER_LENGTH> input_shaper;
+
+void setup_input_shaper()
+{
+    input_shaper.configure(SHAPER_CONFIG);
+    input_shaper.reset();
+}
+
+void run_input_shaper(uint32_t iterations)
+{
+    for (uint32_t i = 0; i < iterations; ++i) {
+        sink_float = input_shaper.update(triangle(i), CONTROL_DT_S);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// BacklashCompensator
+// ---------------------------------------------------------------------------
+
+/// 遊びの幅 [rad] と遊びを渡る速さ [rad/s]
+constexpr float BACKLASH_WIDTH_RAD      = 0.2f;
+constexpr float BACKLASH_TRAVERSE_RAD_S = 20.0f;
+
+gn10_motor::BacklashCompensator<float> backlash;
+
+void setup_backlash()
+{
+    backlash.configure(BACKLASH_WIDTH_RAD, BACKLASH_TRAVERSE_RAD_S);
+    backlash.reset();
+}
+
+void run_backlash(uint32_t iterations)
+{
+    for (uint32_t i = 0; i < iterations; ++i) {
+        sink_float = backlash.update(triangle(i), CONTROL_DT_S);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// FrictionMap
+// ---------------------------------------------------------------------------
+
+/// 位置の振幅 [rad] (負の位置の折り返しも含めて全区間を引く)
+constexpr float FRICTION_POSITION_AMPLITUDE_RAD = 20.0f;
+
+gn10_motor::FrictionMap friction_map;
+
+void setup_friction_map()
+{
+    // 1 回転に 8 周期の鋸歯状の負荷 (±0.03) と、向きで異なる摩擦
+    friction_map.speed_rad_s       = 1.0f;
+    friction_map.friction_positive = 0.06f;
+    friction_map.friction_negative = 0.05f;
+    for (std::size_t i = 0; i < gn10_motor::FRICTION_MAP_BINS; ++i) {
+        const float saw = static_cast<float>(i % 32U) / 16.0f - 1.0f;
+        friction_map.position_duty[i] = gn10_motor::friction_to_fixed(0.03f * saw);
+    }
+}
+
+void run_friction_map(uint32_t iterations)
+{
+    for (uint32_t i = 0; i < iterations; ++i) {
+        const float position  = triangle(i) * FRICTION_POSITION_AMPLITUDE_RAD;
+        const float direction = static_cast<float>((i / INPUT_PERIOD) % 3U) - 1.0f;
+        sink_float            = gn10_motor::friction_feedforward(friction_map, position, direction);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// MotorController (フェイクハードウェア)
+// ---------------------------------------------------------------------------
+
+/// 速度制御のゲイン {kp, ki, kd}
+constexpr std::array<float, 3> SPEED_GAINS = {0.05f, 0.5f, 0.0f};
+
+/// 目標速度の振幅 [rad/s]
+constexpr float TARGET_AMPLITUDE_RAD_S = 50.0f;
+
+/// 1 制御周期あたりのエンコーダカウントの振幅 (約 50 rad/s)
+constexpr float COUNT_AMPLITUDE = 32.0f;
+
+std::optional<gn10_motor::host::MotorRig> rig;
+
+void setup_motor_controller()
+{
+    rig.emplace(0U);
+
+    gn10_can::devices::MotorConfig config;
+    config.set_encoder_type(gn10_can::devices::EncoderType::IncrementalSpeed);
+    config.set_max_duty_ratio(0.9f);
+    config.set_accel_ratio(0.02f);
+    rig->configure(config, SPEED_GAINS);
+    rig->tick(CONTROL_DT_S);
+}
+
+/**
+ * @brief 実機の 1 制御周期分 (目標値フレームの受信 + MotorController::update()) を測る
+ *        ホスト側の目標値送信とエンコーダ入力の設定も含む
+ */
+void run_motor_controller(uint32_t iterations)
+{
+    for (uint32_t i = 0; i < iterations; ++i) {
+        const float wave = triangle(i);
+        rig->send_target(wave * TARGET_AMPLITUDE_RAD_S);
+        rig->encoder().set_next_count(static_cast<int16_t>(wave * COUNT_AMPLITUDE));
+        rig->tick(CONTROL_DT_S);
+    }
+    sink_float = rig->gate_driver().last_output();
+}
+
+// ---------------------------------------------------------------------------
+
+/// 登録済みの処理 (名前は --kernel と count_instructions.py で指定する)
+const Kernel KERNELS[] = {
+    {           "pid_float",            setup_pid_float,            run_pid_float},
+    {          "pid_double",           setup_pid_double,           run_pid_double},
+    {       "accel_limiter",              setup_limiter,              run_limiter},
+    {        "jerk_limiter",         setup_jerk_limiter,         run_jerk_limiter},
+    {   "tracking_observer",             setup_observer,             run_observer},
+    {      "biquad_cascade",               setup_biquad,               run_biquad},
+    {"disturbance_observer", setup_disturbance_observer, run_disturbance_observer},
+    {        "input_shaper",         setup_input_shaper,         run_input_shaper},
+    {            "backlash",             setup_backlash,             run_backlash},
+    {"friction_feedforward",         setup_friction_map,         run_friction_map},
+    {    "motor_controller",     setup_motor_controller,     run_motor_controller},
+};
+
+}  // namespace
+
+const Kernel* kernels(std::size_t& count)
+{
+    count = sizeof(KERNELS) / sizeof(KERNELS[0]);
+    return KERNELS;
+}
+
+const Kernel* find_kernel(const char* name)
+{
+    for (const Kernel& kernel : KERNELS) {
+        if (std::strcmp(kernel.name, name) == 0) {
+            return &kernel;
+        }
+    }
+    return nullptr;
+}
+
+}  // namespace bench
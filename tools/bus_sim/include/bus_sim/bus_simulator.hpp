@@ -0,0 +1,137 @@
+/**
+ * @file bus_simulator.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief CAN バスの調停とフレーム送信の離散イベントシミュレータ
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <vector>
+
+#include "bus_sim/can_timing.hpp"
+#include "host_common/frame_tap.hpp"
+
+namespace bus_sim {
+
+/**
+ * @brief ノードの送信側の設定
+ */
+struct NodeConfig {
+    uint8_t tx_buffer_count;   ///< 送信バッファの段数 (満杯なら新しいフレームを捨てる)
+    bool auto_retransmission;  ///< 調停に負けたフレームを再送するか (false なら捨てる)
+    bool tx_fifo_order;        ///< true: FIFO 順に送る / false: バッファ内で ID の小さい順に送る
+};
+
+/**
+ * @brief 送信要求 (ノードのソフトウェアが送信バッファへ積もうとしたフレーム)
+ */
+struct TxRequest {
+    uint64_t release_ns;                  ///< 送信バッファへ積む時刻 [ns]
+    uint8_t node;                         ///< 送信ノードの番号 (add_node() の戻り値)
+    gn10_motor::host::TappedFrame frame;  ///< フレーム
+};
+
+/**
+ * @brief CAN ID ごとの統計
+ */
+struct IdStats {
+    uint8_t node               = 0U;  ///< 送信ノード
+    uint64_t requested         = 0U;  ///< 送信要求数
+    uint64_t sent              = 0U;  ///< 送信完了数
+    uint64_t buffer_full       = 0U;  ///< 送信バッファが満杯で捨てた数
+    uint64_t lost_arbitration  = 0U;  ///< 調停に負けて捨てた数 (再送なしのノードのみ)
+    uint64_t latency_sum_ns    = 0U;  ///< 送信要求から送信完了までの時間の合計 [ns]
+    uint64_t max_latency_ns    = 0U;  ///< 送信要求から送信完了までの時間の最大値 [ns]
+    uint64_t frame_duration_ns = 0U;  ///< 最後に送ったフレームのバス占有時間 [ns]
+};
+
+/**
+ * @brief CAN バスのシミュレータ
+ *
+ * バスが空くと、送信待ちのフレームを持つ全ノードが同時に SOF を送り、ID の最も小さい
+ * フレームが調停に勝つ。負けたノードは再送ありなら次の調停まで待ち、再送なし
+ * (AutoRetransmission = DISABLE) ならそのフレームを捨てる。
+ * エラーフレームと受信側の処理は扱わない。
+ */
+class BusSimulator
+{
+public:
+    /**
+     * @brief コンストラクタ
+     * @param config ビットレート
+     */
+    explicit BusSimulator(const BusConfig& config);
+
+    /**
+     * @brief ノードを追加する
+     * @param config 送信側の設定
+     * @return uint8_t ノード番号
+     */
+    uint8_t add_node(const NodeConfig& config);
+
+    /**
+     * @brief 送信要求をすべて処理する
+     * @param requests release_ns の昇順に並んだ送信要求
+     */
+    void run(const std::vector<TxRequest>& requests);
+
+    /**
+     * @brief CAN ID ごとの統計を返す
+     * @return const std::map<uint32_t, IdStats>& ID をキーとする統計
+     */
+    const std::map<uint32_t, IdStats>& id_stats() const
+    {
+        return id_stats_;
+    }
+
+    /**
+     * @brief バスがフレームを送っていた時間の合計を返す
+     * @return uint64_t 占有時間 [ns]
+     */
+    uint64_t busy_ns() const
+    {
+        return busy_ns_;
+    }
+
+    /**
+     * @brief 最後のフレームの送信完了時刻を返す
+     * @return uint64_t 時刻 [ns]
+     */
+    uint64_t end_ns() const
+    {
+        return now_ns_;
+    }
+
+private:
+    struct Node {
+        NodeConfig config;
+        std::deque<TxRequest> buffer;
+    };
+
+    /**
+     * @brief release_ns が limit_ns 以下 (inclusive) または未満の送信要求を送信バッファへ積む
+     */
+    void release_until(const std::vector<TxRequest>& requests, uint64_t limit_ns, bool inclusive);
+
+    /**
+     * @brief ノードが次に送るフレームの位置を返す
+     */
+    std::size_t next_index(const Node& node) const;
+
+    BusConfig config_;
+    std::vector<Node> nodes_;
+    std::map<uint32_t, IdStats> id_stats_;
+    std::size_t next_request_ = 0U;
+    uint64_t now_ns_          = 0U;
+    uint64_t busy_ns_         = 0U;
+};
+
+}  // namespace bus_sim
@@ -0,0 +1,75 @@
+/**
+ * @file can_timing.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief CAN のビットタイミング設定とフレーム長の計算
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#pragma once
+
+#include <cstdint>
+
+#include "host_common/frame_tap.hpp"
+
+namespace bus_sim {
+
+/**
+ * @brief バスとボードの CAN ペリフェラルの設定
+ *        既定値は HTMDv2.2c-g431 の fdcan.c (64MHz) と同じ
+ */
+struct BusConfig {
+    uint32_t nominal_bitrate = 1000000U;  ///< アービトレーションフェーズ [bit/s]
+    uint32_t data_bitrate    = 4000000U;  ///< CAN FD データフェーズ [bit/s]
+    bool fd_capable          = true;      ///< CAN FD を送信できるペリフェラルか
+    bool auto_retransmission = false;     ///< 調停負け・エラー時に再送するか
+    bool tx_fifo_order       = true;      ///< true: 送信バッファを FIFO 順に送る / false: ID 優先
+    uint8_t tx_buffer_count  = 3U;        ///< 送信バッファの段数
+};
+
+/**
+ * @brief CubeMX が生成した fdcan.c (FDCAN) または can.c (bxCAN) から設定を読み込む
+ *
+ * hfdcanX.Init / hcan.Init の値だけを見る。ビットレートは
+ * can_clock_hz / ClockDivider / Prescaler / (1 + TimeSeg1 + TimeSeg2) で求める。
+ *
+ * @param path         fdcan.c または can.c のパス
+ * @param can_clock_hz CAN ペリフェラルのクロック [Hz] (FDCAN: PCLK1 / bxCAN: APB1)
+ * @param config       読み込み先 (見つからなかった項目は変更しない)
+ * @return true ビットレートを求められた
+ */
+bool load_bus_config(const char* path, uint32_t can_clock_hz, BusConfig& config);
+
+/**
+ * @brief 1 フレームのビット数 (ビットスタッフィング・フレーム間スペースを含む)
+ */
+struct FrameBits {
+    uint32_t nominal;  ///< アービトレーションのビットレートで送るビット数
+    uint32_t data;     ///< CAN FD のデータフェーズのビットレートで送るビット数
+};
+
+/**
+ * @brief フレームのビット数を求める
+ *
+ * クラシック CAN は CRC-15 を計算し、SOF から CRC までの実際のスタッフビットを数える。
+ * CAN FD は SOF からデータ末尾までの実際のスタッフビットと、スタッフカウント・CRC の
+ * 固定スタッフビットを数える (CRC の値によるスタッフビットはない)。
+ * どちらも標準 ID のデータフレームとし、フレーム間スペース 3 bit を含める。
+ *
+ * @param frame 送信フレーム
+ * @return FrameBits フェーズごとのビット数
+ */
+FrameBits frame_bits(const gn10_motor::host::TappedFrame& frame);
+
+/**
+ * @brief フレームがバスを占有する時間を求める
+ * @param bits   frame_bits() の結果
+ * @param config ビットレート
+ * @return uint64_t 占有時間 [ns]
+ */
+uint64_t frame_duration_ns(const FrameBits& bits, const BusConfig& config);
+
+}  // namespace bus_sim
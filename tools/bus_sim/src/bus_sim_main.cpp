@@ -0,0 +1,481 @@
+/**
+ * @file bus_sim_main.cpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief CAN バスの負荷・遅延解析ツールのエントリポイント
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * 使い方:
+ *   gn10_bus_sim [--nodes <n>] [--policy <policy>] [--fd] [--stamp] [--host-period <cycles>]
+ *                [--duration <ms>] [--config <fdcan.c|can.c>] [--can-clock <MHz>]
+ *                [--bitrate <bit/s>] [--data-bitrate <bit/s>] [--retransmission <on|off>]
+ *                [--phase <random|aligned>] [--seed <n>]
+ *
+ *   --nodes          ボード数 (既定: 4)
+ *   --policy         フィードバック送信ポリシー (既定: every)
+ *                      every / decimate:<cycles> / onchange:<cycles>:<threshold> / polled:<cycles>
+ *   --fd             フィードバックを CAN FD の ExtendedFeedback にする (SetFrameFormat)
+ *   --stamp          クラシック CAN のフィードバックに FeedbackStamp を付ける (SetFeedbackStamp)
+ *   --host-period    ホストが全ボードへ目標値を送る周期 [制御周期] (既定: 1。0 で送らない)
+ *   --duration       解析する時間 [ms] (既定: 1000)
+ *   --config         ビットタイミングを読む fdcan.c / can.c (既定: HTMDv2.2c-g431 と同じ設定)
+ *   --can-clock      CAN ペリフェラルのクロック [MHz] (既定: 64)
+ *   --bitrate        アービトレーションのビットレート (--config より優先)
+ *   --data-bitrate   CAN FD データフェーズのビットレート (--config より優先)
+ *   --retransmission ボードの調停負け時の再送 (既定: --config の AutoRetransmission)
+ *   --phase          ボードの制御周期の位相 (random: 乱数 / aligned: Sync の位相合わせ相当)
+ *   --seed           random の乱数の種 (既定: 1)
+ */
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "bus_sim/bus_simulator.hpp"
+#include "bus_sim/can_timing.hpp"
+#include "gn10_motor/extension_protocol.hpp"
+#include "gn10_motor/feedback_scheduler.hpp"
+#include "host_common/frame_tap.hpp"
+#include "host_common/motor_plant.hpp"
+#include "host_common/motor_rig.hpp"
+
+namespace {
+
+/// 制御周期 [ns] (実機の htim6 と同じ 1 ms)
+constexpr uint64_t CONTROL_PERIOD_NS = 1000000ULL;
+
+/// 制御周期 [s]
+constexpr float CONTROL_DT_S = 0.001f;
+
+/// 1 ミリ秒あたりの制御周期の数
+constexpr uint64_t CYCLES_PER_MS = 1U;
+
+/// ホスト (PC 側の CAN アダプタ) の送信バッファの段数。ボードより十分大きく、再送ありとする
+constexpr uint8_t HOST_TX_BUFFER_COUNT = 64U;
+
+/// 速度制御のゲイン {kp, ki, kd} (bench の motor_controller と同じ)
+constexpr std::array<float, 3> SPEED_GAINS = {0.05f, 0.5f, 0.0f};
+
+/// 目標速度の振幅 [rad/s]
+constexpr float TARGET_AMPLITUDE_RAD_S = 30.0f;
+
+/// 目標速度の周波数 [Hz]
+constexpr float TARGET_FREQUENCY_HZ = 1.0f;
+
+/// 1 秒あたりのナノ秒
+constexpr double NS_PER_S = 1e9;
+
+/// 1 マイクロ秒あたりのナノ秒
+constexpr double NS_PER_US = 1e3;
+
+struct Options {
+    uint32_t nodes              = 4U;
+    uint32_t poll_cycles        = 0U;  ///< polled: ホストが RequestFeedback を送る周期
+    bool fd                     = false;
+    bool stamp                  = false;
+    uint32_t host_period_cycles = 1U;
+    uint32_t duration_ms        = 1000U;
+    const char* config_path     = nullptr;
+    uint32_t can_clock_hz       = 64000000U;
+    uint32_t bitrate            = 0U;  ///< 0: --config の値
+    uint32_t data_bitrate       = 0U;  ///< 0: --config の値
+    int retransmission          = -1;  ///< -1: --config の値 / 0: なし / 1: あり
+    bool aligned                = false;
+    uint32_t seed               = 1U;
+
+    gn10_motor::FeedbackPolicy policy;
+};
+
+void print_usage(const char* program)
+{
+    std::printf(
+        "usage: %s [--nodes <n>] [--policy <policy>] [--fd] [--stamp] [--host-period <cycles>]\n"
+        "          [--duration <ms>] [--config <fdcan.c|can.c>] [--can-clock <MHz>]\n"
+        "          [--bitrate <bit/s>] [--data-bitrate <bit/s>] [--retransmission <on|off>]\n"
+        "          [--phase <random|aligned>] [--seed <n>]\n"
+        "  policy: every | decimate:<cycles> | onchange:<cycles>:<threshold> | polled:<cycles>\n",
+        program
+    );
+}
+
+/**
+ * @brief --policy の値を読む
+ * @param text    "every" / "decimate:10" / "onchange:50:0.5" / "polled:10"
+ * @param options 読み込み先
+ * @return true 読めた
+ */
+bool parse_policy(const char* text, Options& options)
+{
+    gn10_motor::FeedbackPolicy& policy = options.policy;
+    char* cursor                       = nullptr;
+
+    if (std::strcmp(text, "every") == 0) {
+        policy.mode = gn10_motor::FeedbackMode::EveryCycle;
+        return true;
+    }
+    if (std::strncmp(text, "decimate:", 9) == 0) {
+        policy.mode          = gn10_motor::FeedbackMode::Decimate;
+        policy.period_cycles = static_cast<uint16_t>(std::strtoul(text + 9, nullptr, 10));
+        return policy.period_cycles > 0U;
+    }
+    if (std::strncmp(text, "onchange:", 9) == 0) {
+        policy.mode          = gn10_motor::FeedbackMode::OnChange;
+        policy.period_cycles = static_cast<uint16_t>(std::strtoul(text + 9, &cursor, 10));
+        if (*cursor != ':') {
+            return false;
+        }
+        policy.delta_threshold = std::strtof(cursor + 1, nullptr);
+        return true;
+    }
+    if (std::strncmp(text, "polled:", 7) == 0) {
+        policy.mode         = gn10_motor::FeedbackMode::Polled;
+        options.poll_cycles = static_cast<uint32_t>(std::strtoul(text + 7, nullptr, 10));
+        return options.poll_cycles > 0U;
+    }
+    return false;
+}
+
+bool parse_options(int argc, char** argv, Options& options)
+{
+    for (int i = 1; i < argc; ++i) {
+        const char* arg      = argv[i];
+        const bool has_value = i + 1 < argc;
+        if (std::strcmp(arg, "--fd") == 0) {
+            options.fd = true;
+        } else if (std::strcmp(arg, "--stamp") == 0) {
+            options.stamp = true;
+        } else if (!has_value) {
+            return false;
+        } else if (std::strcmp(arg, "--nodes") == 0) {
+            options.nodes = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(arg, "--policy") == 0) {
+            if (!parse_policy(argv[++i], options)) {
+                return false;
+            }
+        } else if (std::strcmp(arg, "--host-period") == 0) {
+            options.host_period_cycles =
+                static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(arg, "--duration") == 0) {
+            options.duration_ms = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(arg, "--config") == 0) {
+            options.config_path = argv[++i];
+        } else if (std::strcmp(arg, "--can-clock") == 0) {
+            options.can_clock_hz = static_cast<uint32_t>(std::strtod(argv[++i], nullptr) * 1e6);
+        } else if (std::strcmp(arg, "--bitrate") == 0) {
+            options.bitrate = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(arg, "--data-bitrate") == 0) {
+            options.data_bitrate = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(arg, "--retransmission") == 0) {
+            options.retransmission = static_cast<int>(std::strcmp(argv[++i], "on") == 0);
+        } else if (std::strcmp(arg, "--phase") == 0) {
+            options.aligned = std::strcmp(argv[++i], "aligned") == 0;
+        } else if (std::strcmp(arg, "--seed") == 0) {
+            options.seed = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else {
+            return false;
+        }
+    }
+    return options.nodes > 0U && options.nodes <= gn10_motor::extension::BOARD_ID_COUNT &&
+           options.duration_ms > 0U;
+}
+
+/**
+ * @brief 送信フレームを送信要求として記録する
+ */
+class TrafficRecorder : public gn10_motor::host::IFrameTap
+{
+public:
+    TrafficRecorder(std::vector<bus_sim::TxRequest>& requests, uint8_t node)
+        : requests_(requests), node_(node)
+    {
+    }
+
+    /**
+     * @brief 以降に記録するフレームの送信要求時刻を設定する
+     * @param release_ns 時刻 [ns]
+     */
+    void set_time(uint64_t release_ns)
+    {
+        release_ns_ = release_ns;
+    }
+
+    void on_frame(const gn10_motor::host::TappedFrame& frame) override
+    {
+        requests_.push_back(bus_sim::TxRequest{release_ns_, node_, frame});
+    }
+
+private:
+    std::vector<bus_sim::TxRequest>& requests_;
+    const uint8_t node_;
+    uint64_t release_ns_ = 0U;
+};
+
+/**
+ * @brief 1 ボード分の制御系・モータモデル・送信フレームの記録先
+ */
+struct Board {
+    Board(uint8_t board_id, uint8_t max_payload, std::vector<bus_sim::TxRequest>& requests)
+        : rig(board_id, max_payload),
+          plant(
+              gn10_motor::host::PlantParameters{},
+              gn10_motor::host::MotorRig::ENCODER_COUNTS_PER_REV
+          ),
+          recorder(requests, static_cast<uint8_t>(board_id + 1U))
+    {
+    }
+
+    gn10_motor::host::MotorRig rig;
+    gn10_motor::host::MotorPlant plant;
+    TrafficRecorder recorder;
+    uint64_t phase_ns = 0U;
+};
+
+/**
+ * @brief ボードに設定とフィードバックの送信方法を設定する (記録しない)
+ * @param board   対象ボード
+ * @param options 実行設定
+ */
+void configure_board(Board& board, const Options& options)
+{
+    gn10_can::devices::MotorConfig config;
+    config.set_encoder_type(gn10_can::devices::EncoderType::IncrementalSpeed);
+    config.set_max_duty_ratio(0.9f);
+    config.set_accel_ratio(0.02f);
+    board.rig.configure(config, SPEED_GAINS);
+
+    namespace ext = gn10_motor::extension;
+
+    uint8_t policy[8] = {static_cast<uint8_t>(ext::Command::SetFeedbackPolicy)};
+    policy[1]         = static_cast<uint8_t>(options.policy.mode);
+    ext::write_le<uint16_t>(&policy[2], options.policy.period_cycles);
+    ext::write_le<float>(&policy[4], options.policy.delta_threshold);
+    board.rig.send_extension(policy, sizeof(policy));
+
+    const uint8_t frame_format[2] = {
+        static_cast<uint8_t>(ext::Command::SetFrameFormat), static_cast<uint8_t>(options.fd)
+    };
+    board.rig.send_extension(frame_format, sizeof(frame_format));
+
+    const uint8_t stamp[2] = {
+        static_cast<uint8_t>(ext::Command::SetFeedbackStamp), static_cast<uint8_t>(options.stamp)
+    };
+    board.rig.send_extension(stamp, sizeof(stamp));
+
+    board.rig.tick(CONTROL_DT_S);
+}
+
+/**
+ * @brief 全ボードを解析時間分動かし、送信要求を記録する
+ * @param boards  ボード
+ * @param options 実行設定
+ * @param host    ホストの送信フレームの記録先
+ */
+void generate_traffic(
+    std::vector<std::unique_ptr<Board>>& boards, const Options& options, TrafficRecorder& host
+)
+{
+    namespace ext = gn10_motor::extension;
+
+    const uint64_t cycles = options.duration_ms * CYCLES_PER_MS;
+    for (uint64_t cycle = 0; cycle < cycles; ++cycle) {
+        const uint64_t cycle_ns = cycle * CONTROL_PERIOD_NS;
+        const float t_s         = static_cast<float>(static_cast<double>(cycle_ns) / NS_PER_S);
+
+        // ホスト: 全ボードへ目標値 (ボードごとに位相をずらした正弦波) と polled の要求を送る
+        host.set_time(cycle_ns);
+        for (std::size_t i = 0; i < boards.size(); ++i) {
+            Board& board = *boards[i];
+            if (options.host_period_cycles > 0U && cycle % options.host_period_cycles == 0U) {
+                const float offset = static_cast<float>(i) / static_cast<float>(boards.size());
+                const float turns  = TARGET_FREQUENCY_HZ * t_s + offset;
+                const float phase  = gn10_motor::host::TWO_PI * turns;
+                board.rig.send_target(TARGET_AMPLITUDE_RAD_S * std::sin(phase));
+            }
+            if (options.poll_cycles > 0U && cycle % options.poll_cycles == 0U) {
+                // 拡張コマンドは MotorRig のバスを通らないため、送信要求を直接記録する
+                const uint8_t board_id                = board.rig.extension_server().board_id();
+                gn10_motor::host::TappedFrame request = {ext::command_id(board_id), 1U, false};
+                request.data[0] = static_cast<uint8_t>(ext::Command::RequestFeedback);
+                host.on_frame(request);
+                board.rig.send_extension(request.data.data(), request.length);
+            }
+        }
+
+        // ボード: 各自の位相の制御周期で MotorController::update() を実行する
+        for (auto& board : boards) {
+            board->recorder.set_time(cycle_ns + board->phase_ns);
+            board->plant.step(board->rig.gate_driver().last_output(), CONTROL_DT_S);
+            board->rig.encoder().set_next_count(board->plant.take_count());
+            board->rig.tick(CONTROL_DT_S);
+        }
+    }
+}
+
+/**
+ * @brief 解析結果を表示する
+ * @param simulator 実行済みのシミュレータ
+ * @param options   実行設定
+ * @param bus       バスの設定
+ */
+void print_report(
+    const bus_sim::BusSimulator& simulator, const Options& options, const bus_sim::BusConfig& bus
+)
+{
+    const char* retransmission = "off";
+    if (bus.auto_retransmission) {
+        retransmission = "on";
+    }
+    const char* order = "FIFO";
+    if (!bus.tx_fifo_order) {
+        order = "ID priority";
+    }
+    std::printf(
+        "bus: %u kbit/s (data %u kbit/s), %u boards + host, tx buffer %u (%s), retransmission %s\n",
+        bus.nominal_bitrate / 1000U,
+        bus.data_bitrate / 1000U,
+        options.nodes,
+        bus.tx_buffer_count,
+        order,
+        retransmission
+    );
+
+    const double duration_ns = static_cast<double>(options.duration_ms) * 1e6;
+    std::printf(
+        "\nbus utilization %.1f %%  (busy %.1f ms / %u ms)\n",
+        100.0 * static_cast<double>(simulator.busy_ns()) / duration_ns,
+        static_cast<double>(simulator.busy_ns()) / 1e6,
+        options.duration_ms
+    );
+
+    std::printf("\n    ID  source     requested       sent  buffer full  lost arb");
+    std::printf("  frame [us]  mean [us]   max [us]\n");
+    for (const auto& [id, stats] : simulator.id_stats()) {
+        char source[16] = "host";
+        if (stats.node > 0U) {
+            std::snprintf(source, sizeof(source), "board %u", stats.node - 1U);
+        }
+        double mean_us = 0.0;
+        if (stats.sent > 0U) {
+            mean_us = static_cast<double>(stats.latency_sum_ns) / static_cast<double>(stats.sent) /
+                      NS_PER_US;
+        }
+        std::printf(
+            "  0x%03X %-9s %10lu %10lu %12lu %9lu %11.1f %10.1f %10.1f\n",
+            static_cast<unsigned>(id),
+            source,
+            static_cast<unsigned long>(stats.requested),
+            static_cast<unsigned long>(stats.sent),
+            static_cast<unsigned long>(stats.buffer_full),
+            static_cast<unsigned long>(stats.lost_arbitration),
+            static_cast<double>(stats.frame_duration_ns) / NS_PER_US,
+            mean_us,
+            static_cast<double>(stats.max_latency_ns) / NS_PER_US
+        );
+    }
+
+    // ボードが送ったフレーム (フィードバックと拡張応答) のうち届かなかった割合
+    std::printf("\n  board  requested       sent    dropped\n");
+    for (uint32_t node = 1; node <= options.nodes; ++node) {
+        uint64_t requested = 0U;
+        uint64_t sent      = 0U;
+        for (const auto& [id, stats] : simulator.id_stats()) {
+            if (stats.node == node) {
+                requested += stats.requested;
+                sent += stats.sent;
+            }
+        }
+        double dropped_percent = 0.0;
+        if (requested > 0U) {
+            dropped_percent =
+                100.0 * static_cast<double>(requested - sent) / static_cast<double>(requested);
+        }
+        std::printf(
+            "  %5u %10lu %10lu %8.2f %%\n",
+            node - 1U,
+            static_cast<unsigned long>(requested),
+            static_cast<unsigned long>(sent),
+            dropped_percent
+        );
+    }
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    Options options;
+    if (!parse_options(argc, argv, options)) {
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    bus_sim::BusConfig bus;
+    if (options.config_path != nullptr &&
+        !bus_sim::load_bus_config(options.config_path, options.can_clock_hz, bus)) {
+        std::fprintf(stderr, "cannot read bit timing from %s\n", options.config_path);
+        return EXIT_FAILURE;
+    }
+    if (options.bitrate > 0U) {
+        bus.nominal_bitrate = options.bitrate;
+    }
+    if (options.data_bitrate > 0U) {
+        bus.data_bitrate = options.data_bitrate;
+    }
+    if (options.retransmission >= 0) {
+        bus.auto_retransmission = options.retransmission != 0;
+    }
+
+    // ノード 0 はホスト、ノード 1 以降は board_id = ノード番号 - 1 のボード
+    bus_sim::BusSimulator simulator(bus);
+    simulator.add_node(bus_sim::NodeConfig{HOST_TX_BUFFER_COUNT, true, true});
+    for (uint32_t i = 0; i < options.nodes; ++i) {
+        simulator.add_node(
+            bus_sim::NodeConfig{bus.tx_buffer_count, bus.auto_retransmission, bus.tx_fifo_order}
+        );
+    }
+
+    std::vector<bus_sim::TxRequest> requests;
+    TrafficRecorder host(requests, 0U);
+
+    uint8_t max_payload = gn10_motor::extension::CLASSIC_PAYLOAD_LENGTH;
+    if (bus.fd_capable) {
+        max_payload = gn10_motor::extension::FD_PAYLOAD_LENGTH;
+    }
+
+    std::mt19937 random(options.seed);
+    std::uniform_int_distribution<uint64_t> phase(0U, CONTROL_PERIOD_NS - 1U);
+
+    std::vector<std::unique_ptr<Board>> boards;
+    for (uint32_t i = 0; i < options.nodes; ++i) {
+        auto board = std::make_unique<Board>(static_cast<uint8_t>(i), max_payload, requests);
+        configure_board(*board, options);
+        board->rig.set_frame_taps(&host, &board->recorder);
+        if (!options.aligned) {
+            board->phase_ns = phase(random);
+        }
+        boards.push_back(std::move(board));
+    }
+
+    generate_traffic(boards, options, host);
+
+    // 同時刻の送信要求はノード内の送信順を保つ
+    std::stable_sort(
+        requests.begin(),
+        requests.end(),
+        [](const bus_sim::TxRequest& a, const bus_sim::TxRequest& b) {
+            return a.release_ns < b.release_ns;
+        }
+    );
+    simulator.run(requests);
+    print_report(simulator, options, bus);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,127 @@
+/**
+ * @file bus_simulator.cpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief CAN バスの調停とフレーム送信の離散イベントシミュレータの実装
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#include "bus_sim/bus_simulator.hpp"
+
+#include <algorithm>
+
+namespace bus_sim {
+
+BusSimulator::BusSimulator(const BusConfig& config) : config_(config) {}
+
+uint8_t BusSimulator::add_node(const NodeConfig& config)
+{
+    nodes_.push_back(Node{config, {}});
+    return static_cast<uint8_t>(nodes_.size() - 1U);
+}
+
+void BusSimulator::run(const std::vector<TxRequest>& requests)
+{
+    next_request_ = 0U;
+    now_ns_       = 0U;
+    busy_ns_      = 0U;
+
+    while (true) {
+        release_until(requests, now_ns_, true);
+
+        // バスが空いた時点で送信待ちの全ノードが同時に調停に参加する
+        Node* winner          = nullptr;
+        std::size_t win_index = 0U;
+        for (Node& node : nodes_) {
+            if (node.buffer.empty()) {
+                continue;
+            }
+            const std::size_t index = next_index(node);
+            const uint32_t id       = node.buffer[index].frame.id;
+            if (winner == nullptr || id < winner->buffer[win_index].frame.id) {
+                winner    = &node;
+                win_index = index;
+            }
+        }
+
+        if (winner == nullptr) {
+            if (next_request_ >= requests.size()) {
+                break;
+            }
+            now_ns_ = requests[next_request_].release_ns;
+            continue;
+        }
+
+        // 再送なしのノードは調停に負けたフレームを捨てる
+        for (Node& node : nodes_) {
+            if (&node == winner || node.buffer.empty() || node.config.auto_retransmission) {
+                continue;
+            }
+            const std::size_t index = next_index(node);
+            ++id_stats_[node.buffer[index].frame.id].lost_arbitration;
+            node.buffer.erase(node.buffer.begin() + static_cast<std::ptrdiff_t>(index));
+        }
+
+        const TxRequest& request = winner->buffer[win_index];
+        const uint64_t duration  = frame_duration_ns(frame_bits(request.frame), config_);
+        const uint64_t end_ns    = now_ns_ + duration;
+
+        IdStats& stats          = id_stats_[request.frame.id];
+        const uint64_t latency  = end_ns - request.release_ns;
+        stats.max_latency_ns    = std::max(stats.max_latency_ns, latency);
+        stats.frame_duration_ns = duration;
+        stats.latency_sum_ns += latency;
+        ++stats.sent;
+
+        // 送信中のフレームは完了するまで送信バッファを占有する
+        release_until(requests, end_ns, false);
+        winner->buffer.erase(winner->buffer.begin() + static_cast<std::ptrdiff_t>(win_index));
+
+        busy_ns_ += duration;
+        now_ns_ = end_ns;
+    }
+}
+
+void BusSimulator::release_until(
+    const std::vector<TxRequest>& requests, uint64_t limit_ns, bool inclusive
+)
+{
+    while (next_request_ < requests.size()) {
+        const TxRequest& request = requests[next_request_];
+        const bool due =
+            request.release_ns < limit_ns || (inclusive && request.release_ns == limit_ns);
+        if (!due) {
+            return;
+        }
+        ++next_request_;
+
+        Node& node     = nodes_[request.node];
+        IdStats& stats = id_stats_[request.frame.id];
+        stats.node     = request.node;
+        ++stats.requested;
+        if (node.buffer.size() >= node.config.tx_buffer_count) {
+            ++stats.buffer_full;
+            continue;
+        }
+        node.buffer.push_back(request);
+    }
+}
+
+std::size_t BusSimulator::next_index(const Node& node) const
+{
+    if (node.config.tx_fifo_order) {
+        return 0U;
+    }
+    std::size_t best = 0U;
+    for (std::size_t i = 1; i < node.buffer.size(); ++i) {
+        if (node.buffer[i].frame.id < node.buffer[best].frame.id) {
+            best = i;
+        }
+    }
+    return best;
+}
+
+}  // namespace bus_sim
@@ -0,0 +1,356 @@
+/**
+ * @file can_timing.cpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief CAN のビットタイミング設定とフレーム長の計算の実装
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#include "bus_sim/can_timing.hpp"
+
+#include <array>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+namespace bus_sim {
+
+namespace {
+
+// ---------------------------------------------------------------------------
+// 設定ファイルの読み込み
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief "<handle>.Init.<key> = <token>;" の token を探す
+ * @param text  ファイルの内容
+ * @param key   Init のメンバ名
+ * @param token 見つかった値 (前後の空白を除く)
+ * @return true 代入文が見つかった
+ */
+bool find_init_token(const std::string& text, const std::string& key, std::string& token)
+{
+    const std::string pattern = ".Init." + key;
+    std::size_t position      = text.find(pattern);
+    while (position != std::string::npos) {
+        std::size_t cursor = position + pattern.size();
+        while (cursor < text.size() && text[cursor] == ' ') {
+            ++cursor;
+        }
+        // 代入文だけを見る (USER CODE 内で値を参照している箇所は飛ばす)
+        if (cursor < text.size() && text[cursor] == '=') {
+            const std::size_t end = text.find(';', cursor);
+            if (end == std::string::npos) {
+                return false;
+            }
+            std::istringstream stream(text.substr(cursor + 1U, end - cursor - 1U));
+            stream >> token;
+            return true;
+        }
+        position = text.find(pattern, position + pattern.size());
+    }
+    return false;
+}
+
+/**
+ * @brief 数値またはマクロ名の末尾の数字を値として読む
+ *        (例: "4" → 4, "CAN_BS1_11TQ" → 11, "FDCAN_CLOCK_DIV2" → 2)
+ * @param text  ファイルの内容
+ * @param key   Init のメンバ名
+ * @param value 読み込み先 (見つからなければ変更しない)
+ * @return true 値を読めた
+ */
+bool read_init_number(const std::string& text, const std::string& key, uint32_t& value)
+{
+    std::string token;
+    if (!find_init_token(text, key, token)) {
+        return false;
+    }
+    if (token.size() > 2U && token.compare(token.size() - 2U, 2U, "TQ") == 0) {
+        token.resize(token.size() - 2U);
+    }
+    std::size_t begin = token.size();
+    while (begin > 0U && std::isdigit(static_cast<unsigned char>(token[begin - 1U])) != 0) {
+        --begin;
+    }
+    if (begin == token.size()) {
+        return false;
+    }
+    value = static_cast<uint32_t>(std::strtoul(token.c_str() + begin, nullptr, 10));
+    return true;
+}
+
+/**
+ * @brief マクロ名の値を読む
+ * @param text ファイルの内容
+ * @param key  Init のメンバ名
+ * @return std::string 値 (見つからなければ空)
+ */
+std::string read_init_token(const std::string& text, const std::string& key)
+{
+    std::string token;
+    find_init_token(text, key, token);
+    return token;
+}
+
+/**
+ * @brief ビットタイミングからビットレートを求める
+ * @return uint32_t ビットレート [bit/s] (設定が不正なら 0)
+ */
+uint32_t bitrate(uint32_t clock_hz, uint32_t prescaler, uint32_t seg1, uint32_t seg2)
+{
+    const uint32_t time_quanta = prescaler * (1U + seg1 + seg2);
+    if (time_quanta == 0U) {
+        return 0U;
+    }
+    return clock_hz / time_quanta;
+}
+
+// ---------------------------------------------------------------------------
+// フレームのビット数
+// ---------------------------------------------------------------------------
+
+/// スタッフビットを入れる同値ビットの連続数
+constexpr uint8_t STUFF_RUN_LENGTH = 5U;
+
+/// CRC デリミタ・ACK スロット・ACK デリミタ・EOF (7)・フレーム間スペース (3)
+constexpr uint32_t TRAILER_BITS = 1U + 1U + 1U + 7U + 3U;
+
+/// CAN FD の SOF から BRS までのビット数 (SOF・ID 11・RRS・IDE・FDF・res・BRS)
+constexpr uint32_t FD_ARBITRATION_BITS = 17U;
+
+/// CAN FD のスタッフカウント (グレイコード 3 bit + パリティ) のビット数
+constexpr uint32_t FD_STUFF_COUNT_BITS = 4U;
+
+/// CAN FD の DLC コード 9-15 に対応するデータ長 [byte]
+constexpr std::array<uint8_t, 7> FD_LENGTHS = {12, 16, 20, 24, 32, 48, 64};
+
+/**
+ * @brief スタッフィング前のビット列 (SOF から CRC またはデータ末尾まで)
+ */
+class BitSequence
+{
+public:
+    /**
+     * @brief 値の下位 count bit を MSB から追加する
+     */
+    void push(uint32_t value, uint8_t count)
+    {
+        for (uint8_t i = count; i > 0U; --i) {
+            bits_[size_++] = static_cast<uint8_t>((value >> (i - 1U)) & 1U);
+        }
+    }
+
+    uint8_t operator[](std::size_t index) const
+    {
+        return bits_[index];
+    }
+
+    std::size_t size() const
+    {
+        return size_;
+    }
+
+private:
+    // CAN FD の最大 (19 bit + 64 byte) が入る長さ
+    std::array<uint8_t, 19U + 64U * 8U> bits_{};
+    std::size_t size_ = 0U;
+};
+
+/**
+ * @brief CAN の CRC-15 (x^15 + x^14 + x^10 + x^8 + x^7 + x^4 + x^3 + 1) を求める
+ * @param bits SOF からデータ末尾までのビット列
+ * @return uint16_t CRC-15
+ */
+uint16_t crc15(const BitSequence& bits)
+{
+    constexpr uint16_t POLYNOMIAL = 0x4599U;
+    uint16_t crc                  = 0U;
+    for (std::size_t i = 0; i < bits.size(); ++i) {
+        const bool feedback = (((crc >> 14U) & 1U) ^ bits[i]) != 0U;
+        crc                 = static_cast<uint16_t>((crc << 1U) & 0x7FFFU);
+        if (feedback) {
+            crc ^= POLYNOMIAL;
+        }
+    }
+    return crc;
+}
+
+/**
+ * @brief ビット列に入るスタッフビットを数える
+ * @param bits  スタッフィング前のビット列
+ * @param split この位置より前に入るスタッフビットを before に数える
+ * @param before split より前のスタッフビット数
+ * @param after  split 以降のスタッフビット数
+ */
+void count_stuff_bits(
+    const BitSequence& bits, std::size_t split, uint32_t& before, uint32_t& after
+)
+{
+    before       = 0U;
+    after        = 0U;
+    uint8_t last = 2U;  // どちらの値とも一致しない初期値
+    uint8_t run  = 0U;
+    for (std::size_t i = 0; i < bits.size(); ++i) {
+        if (bits[i] == last) {
+            ++run;
+        } else {
+            last = bits[i];
+            run  = 1U;
+        }
+        if (run == STUFF_RUN_LENGTH) {
+            if (i < split) {
+                ++before;
+            } else {
+                ++after;
+            }
+            // スタッフビットは反転値で、次の連続の 1 bit 目になる
+            last = static_cast<uint8_t>(last ^ 1U);
+            run  = 1U;
+        }
+    }
+}
+
+/**
+ * @brief データ長から DLC コードを求める
+ */
+uint8_t length_to_dlc(uint8_t length)
+{
+    if (length <= 8U) {
+        return length;
+    }
+    uint8_t dlc = 9U;
+    for (const uint8_t fd_length : FD_LENGTHS) {
+        if (fd_length >= length) {
+            break;
+        }
+        ++dlc;
+    }
+    return dlc;
+}
+
+}  // namespace
+
+bool load_bus_config(const char* path, uint32_t can_clock_hz, BusConfig& config)
+{
+    std::ifstream file(path);
+    if (!file) {
+        return false;
+    }
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    const std::string text = buffer.str();
+
+    uint32_t prescaler = 0U;
+    uint32_t seg1      = 0U;
+    uint32_t seg2      = 0U;
+
+    // FDCAN (STM32G4)
+    if (read_init_number(text, "NominalPrescaler", prescaler)) {
+        uint32_t divider = 1U;
+        read_init_number(text, "ClockDivider", divider);
+        const uint32_t clock_hz = can_clock_hz / divider;
+
+        read_init_number(text, "NominalTimeSeg1", seg1);
+        read_init_number(text, "NominalTimeSeg2", seg2);
+        config.nominal_bitrate = bitrate(clock_hz, prescaler, seg1, seg2);
+
+        if (read_init_number(text, "DataPrescaler", prescaler)) {
+            read_init_number(text, "DataTimeSeg1", seg1);
+            read_init_number(text, "DataTimeSeg2", seg2);
+            config.data_bitrate = bitrate(clock_hz, prescaler, seg1, seg2);
+        }
+
+        config.fd_capable          = read_init_token(text, "FrameFormat") != "FDCAN_FRAME_CLASSIC";
+        config.auto_retransmission = read_init_token(text, "AutoRetransmission") == "ENABLE";
+        config.tx_fifo_order =
+            read_init_token(text, "TxFifoQueueMode") != "FDCAN_TX_QUEUE_OPERATION";
+        config.tx_buffer_count = 3U;
+        return config.nominal_bitrate > 0U;
+    }
+
+    // bxCAN (STM32F3)
+    if (read_init_number(text, "Prescaler", prescaler)) {
+        read_init_number(text, "TimeSeg1", seg1);
+        read_init_number(text, "TimeSeg2", seg2);
+        config.nominal_bitrate     = bitrate(can_clock_hz, prescaler, seg1, seg2);
+        config.fd_capable          = false;
+        config.auto_retransmission = read_init_token(text, "AutoRetransmission") == "ENABLE";
+        // 送信メールボックスは TransmitFifoPriority = DISABLE なら ID 優先で送られる
+        config.tx_fifo_order   = read_init_token(text, "TransmitFifoPriority") == "ENABLE";
+        config.tx_buffer_count = 3U;
+        return config.nominal_bitrate > 0U;
+    }
+
+    return false;
+}
+
+FrameBits frame_bits(const gn10_motor::host::TappedFrame& frame)
+{
+    BitSequence bits;
+    bits.push(0U, 1U);         // SOF
+    bits.push(frame.id, 11U);  // ID
+
+    if (!frame.fd) {
+        bits.push(0U, 1U);  // RTR
+        bits.push(0U, 1U);  // IDE
+        bits.push(0U, 1U);  // r0
+        bits.push(frame.length, 4U);
+        for (uint8_t i = 0; i < frame.length; ++i) {
+            bits.push(frame.data[i], 8U);
+        }
+        bits.push(crc15(bits), 15U);
+
+        uint32_t stuff  = 0U;
+        uint32_t unused = 0U;
+        count_stuff_bits(bits, bits.size(), stuff, unused);
+        return FrameBits{static_cast<uint32_t>(bits.size()) + stuff + TRAILER_BITS, 0U};
+    }
+
+    bits.push(0U, 1U);  // RRS
+    bits.push(0U, 1U);  // IDE
+    bits.push(1U, 1U);  // FDF
+    bits.push(0U, 1U);  // res
+    bits.push(1U, 1U);  // BRS
+    bits.push(0U, 1U);  // ESI
+    bits.push(length_to_dlc(frame.length), 4U);
+    for (uint8_t i = 0; i < frame.length; ++i) {
+        bits.push(frame.data[i], 8U);
+    }
+
+    uint32_t arbitration_stuff = 0U;
+    uint32_t data_stuff        = 0U;
+    count_stuff_bits(bits, FD_ARBITRATION_BITS, arbitration_stuff, data_stuff);
+
+    // 16 byte 以下は CRC-17、それより長ければ CRC-21。スタッフカウントの前と以降 4 bit ごとに
+    // 固定スタッフビットが入る
+    uint32_t crc_bits = 17U;
+    if (frame.length > 16U) {
+        crc_bits = 21U;
+    }
+    const uint32_t fixed_stuff = 1U + (FD_STUFF_COUNT_BITS + crc_bits) / 4U;
+
+    const uint32_t data_field = static_cast<uint32_t>(bits.size()) - FD_ARBITRATION_BITS;
+
+    FrameBits result = {};
+    result.nominal   = FD_ARBITRATION_BITS + arbitration_stuff + TRAILER_BITS;
+    result.data      = data_field + data_stuff + FD_STUFF_COUNT_BITS + crc_bits + fixed_stuff;
+    return result;
+}
+
+uint64_t frame_duration_ns(const FrameBits& bits, const BusConfig& config)
+{
+    constexpr uint64_t NS_PER_S = 1000000000ULL;
+    uint64_t duration_ns        = bits.nominal * NS_PER_S / config.nominal_bitrate;
+    if (bits.data > 0U) {
+        duration_ns += bits.data * NS_PER_S / config.data_bitrate;
+    }
+    return duration_ns;
+}
+
+}  // namespace bus_sim
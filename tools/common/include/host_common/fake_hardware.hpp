@@ -0,0 +1,283 @@
+/**
+ * @file fake_hardware.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief ホストツール用の gn10_motor ハードウェアインターフェースの実装
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+#include "gn10_motor/extension_protocol.hpp"
+#include "gn10_motor/i_clock.hpp"
+#include "gn10_motor/i_encoder.hpp"
+#include "gn10_motor/i_extension_transmitter.hpp"
+#include "gn10_motor/i_gate_driver.hpp"
+#include "gn10_motor/i_parameter_flash.hpp"
+#include "host_common/frame_tap.hpp"
+
+namespace gn10_motor::host {
+
+// 2π 定数 (M_PI は POSIX 拡張のため constexpr で定義)
+constexpr float TWO_PI = 6.28318530f;
+
+/**
+ * @brief 出力値を保持するだけのゲートドライバ
+ */
+class FakeGateDriver : public IGateDriver
+{
+public:
+    void hardware_init() override {}
+
+    void output(float output) override
+    {
+        output_ = output;
+    }
+
+    void set_brake(bool brake) override
+    {
+        brake_ = brake;
+    }
+
+    float last_output() const
+    {
+        return output_;
+    }
+
+    bool brake() const
+    {
+        return brake_;
+    }
+
+private:
+    float output_ = 0.0f;
+    bool brake_   = false;
+};
+
+/**
+ * @brief 次に返すカウントを外部から与えるエンコーダ
+ *
+ * 変換は IncrementalEncoder と同じ (counts_per_rev カウントで 1 回転)。
+ */
+class FakeEncoder : public IEncoder
+{
+public:
+    /**
+     * @brief コンストラクタ
+     * @param counts_per_rev 1 回転あたりのカウント数
+     */
+    explicit FakeEncoder(uint16_t counts_per_rev) : counts_per_rev_(counts_per_rev) {}
+
+    /**
+     * @brief 次の read_and_reset_count() で返すカウントを設定する
+     * @param count 前回読み取りからの差分カウント
+     */
+    void set_next_count(int16_t count)
+    {
+        next_count_ = count;
+    }
+
+    void hardware_init() override {}
+
+    int16_t read_and_reset_count() override
+    {
+        const int16_t count = next_count_;
+        next_count_         = 0;
+        return count;
+    }
+
+    float count_to_angular_velocity(int16_t count, float period_s) override
+    {
+        return count_to_rad(count) / period_s;
+    }
+
+    float accumulate_angle_rad(int16_t count) override
+    {
+        angle_rad_ += count_to_rad(count);
+        return angle_rad_;
+    }
+
+    void reset() override
+    {
+        next_count_ = 0;
+        angle_rad_  = 0.0f;
+    }
+
+private:
+    float count_to_rad(int16_t count) const
+    {
+        return static_cast<float>(count) / static_cast<float>(counts_per_rev_) * TWO_PI;
+    }
+
+    const uint16_t counts_per_rev_;
+    int16_t next_count_ = 0;
+    float angle_rad_    = 0.0f;
+};
+
+/**
+ * @brief 外部から進めるボード時刻
+ */
+class FakeClock : public IClock
+{
+public:
+    uint64_t now_us() override
+    {
+        return now_us_;
+    }
+
+    /**
+     * @brief 時刻を進める
+     * @param delta_us 進める時間 [us]
+     */
+    void advance_us(uint64_t delta_us)
+    {
+        now_us_ += delta_us;
+    }
+
+private:
+    uint64_t now_us_ = 0;
+};
+
+/**
+ * @brief 送信フレームを数えるだけの拡張応答送信先
+ *
+ * IFrameTap を設定すると、送信フレームを実機の ExtensionCANPort と同じ形式
+ * (8 byte を超えたら CAN FD、長さは DLC の刻みに切り上げ) で渡す。
+ */
+class NullExtensionTransmitter : public IExtensionTransmitter
+{
+public:
+    /**
+     * @brief コンストラクタ
+     * @param max_payload_length 8 (クラシック CAN) または 64 (CAN FD)
+     */
+    explicit NullExtensionTransmitter(uint8_t max_payload_length)
+        : max_payload_length_(max_payload_length)
+    {
+    }
+
+    /**
+     * @brief 送信フレームの受け取り先を設定する
+     * @param tap 受け取り先 (nullptr で解除)
+     */
+    void set_tap(IFrameTap* tap)
+    {
+        tap_ = tap;
+    }
+
+    bool send(uint32_t id, const uint8_t* data, uint8_t length) override
+    {
+        if (length > max_payload_length_) {
+            return false;
+        }
+        ++sent_count_;
+        if (tap_ != nullptr) {
+            tap_->on_frame(to_tapped_frame(id, data, length));
+        }
+        return true;
+    }
+
+    uint8_t max_payload_length() const override
+    {
+        return max_payload_length_;
+    }
+
+    uint32_t sent_count() const
+    {
+        return sent_count_;
+    }
+
+private:
+    /// CAN FD の DLC コード 9-15 に対応するデータ長 [byte]
+    static constexpr uint8_t FD_LENGTHS[] = {12, 16, 20, 24, 32, 48, 64};
+
+    static TappedFrame to_tapped_frame(uint32_t id, const uint8_t* data, uint8_t length)
+    {
+        TappedFrame frame = {id, length, length > extension::CLASSIC_PAYLOAD_LENGTH};
+        std::memcpy(frame.data.data(), data, length);
+        if (frame.fd) {
+            for (const uint8_t fd_length : FD_LENGTHS) {
+                if (fd_length >= length) {
+                    frame.length = fd_length;
+                    break;
+                }
+            }
+        }
+        return frame;
+    }
+
+    const uint8_t max_payload_length_;
+    uint32_t sent_count_ = 0;
+    IFrameTap* tap_      = nullptr;
+};
+
+/**
+ * @brief RAM 上のパラメータ保存領域 (消去状態は 0xFF)
+ *
+ * 実機のフラッシュと同じく、消去せずに 0xFF 以外のバイトへ書き込もうとすると失敗する。
+ */
+class RamParameterFlash : public IParameterFlash
+{
+public:
+    static constexpr uint32_t PAGE_SIZE  = 2048U;
+    static constexpr uint8_t PAGE_COUNT = 2U;
+
+    RamParameterFlash()
+    {
+        for (auto& page : pages_) {
+            page.fill(ERASED);
+        }
+    }
+
+    uint32_t page_size() const override
+    {
+        return PAGE_SIZE;
+    }
+
+    uint8_t page_count() const override
+    {
+        return PAGE_COUNT;
+    }
+
+    bool erase_page(uint8_t page) override
+    {
+        if (page >= PAGE_COUNT) {
+            return false;
+        }
+        pages_[page].fill(ERASED);
+        return true;
+    }
+
+    bool program(uint8_t page, uint32_t offset, const uint8_t* data, uint32_t length) override
+    {
+        if (page >= PAGE_COUNT || offset + length > PAGE_SIZE) {
+            return false;
+        }
+        for (uint32_t i = 0; i < length; ++i) {
+            if (pages_[page][offset + i] != ERASED) {
+                return false;
+            }
+        }
+        std::memcpy(&pages_[page][offset], data, length);
+        return true;
+    }
+
+    const uint8_t* page_data(uint8_t page) const override
+    {
+        return pages_[page].data();
+    }
+
+private:
+    static constexpr uint8_t ERASED = 0xFFU;
+
+    std::array<std::array<uint8_t, PAGE_SIZE>, PAGE_COUNT> pages_;
+};
+
+}  // namespace gn10_motor::host
@@ -0,0 +1,47 @@
+/**
+ * @file frame_tap.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief ホスト上の CAN 送信フレームの取り出し口
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace gn10_motor::host {
+
+/**
+ * @brief 送信されたフレーム (クラシック CAN / CAN FD 共通)
+ */
+struct TappedFrame {
+    uint32_t id;                     ///< 標準 ID
+    uint8_t length;                  ///< データ長 [byte] (CAN FD は DLC の刻みに切り上げた長さ)
+    bool fd;                         ///< CAN FD (BRS あり) で送信されたか
+    std::array<uint8_t, 64> data{};  ///< データ (length byte 以降は 0)
+};
+
+/**
+ * @brief 送信フレームの受け取り先
+ *
+ * LoopbackCANDriver と NullExtensionTransmitter に設定すると、送信のたびに呼ばれる。
+ * バスのタイミング解析・トレースの記録に使う。
+ */
+class IFrameTap
+{
+public:
+    virtual ~IFrameTap() = default;
+
+    /**
+     * @brief フレームが送信された
+     * @param frame 送信されたフレーム
+     */
+    virtual void on_frame(const TappedFrame& frame) = 0;
+};
+
+}  // namespace gn10_motor::host
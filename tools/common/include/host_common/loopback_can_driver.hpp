@@ -0,0 +1,116 @@
+/**
+ * @file loopback_can_driver.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief 2 つの CANBus をメモリ上でつなぐ gn10_can ドライバ
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "gn10_can/core/can_frame.hpp"
+#include "gn10_can/drivers/driver_interface.hpp"
+#include "host_common/frame_tap.hpp"
+
+namespace gn10_motor::host {
+
+/**
+ * @brief 送信したフレームを接続先の受信キューへ積むドライバ
+ *
+ * 受信キューが満杯のときは実機の受信 FIFO と同じく新しいフレームを捨てる。
+ */
+class LoopbackCANDriver : public gn10_can::drivers::DriverInterface
+{
+public:
+    /// 受信キューの段数 (FDCAN の Rx FIFO と同じ 3 段にはせず、ホスト側の取りこぼしを防ぐ)
+    static constexpr uint8_t QUEUE_DEPTH = 32U;
+
+    /**
+     * @brief 送信先のドライバを設定する
+     * @param peer 送信したフレームを受信するドライバ
+     */
+    void connect(LoopbackCANDriver& peer)
+    {
+        peer_ = &peer;
+    }
+
+    /**
+     * @brief 送信フレームの受け取り先を設定する
+     * @param tap 受け取り先 (nullptr で解除)
+     */
+    void set_tap(IFrameTap* tap)
+    {
+        tap_ = tap;
+    }
+
+    bool send(const gn10_can::CANFrame& frame) override
+    {
+        if (peer_ == nullptr) {
+            return false;
+        }
+        if (tap_ != nullptr) {
+            TappedFrame tapped = {frame.id, frame.dlc, false};
+            for (uint8_t i = 0; i < frame.dlc; ++i) {
+                tapped.data[i] = frame.data[i];
+            }
+            tap_->on_frame(tapped);
+        }
+        return peer_->push(frame);
+    }
+
+    bool receive(gn10_can::CANFrame& frame) override
+    {
+        if (count_ == 0U) {
+            return false;
+        }
+        frame = queue_[head_];
+        head_ = static_cast<uint8_t>((head_ + 1U) % QUEUE_DEPTH);
+        --count_;
+        return true;
+    }
+
+    /**
+     * @brief 受信キューに残っているフレーム数を返す
+     * @return uint8_t 未受信のフレーム数
+     */
+    uint8_t pending_count() const
+    {
+        return count_;
+    }
+
+    /**
+     * @brief 受信キューが満杯で捨てたフレーム数を返す
+     * @return uint32_t 破棄したフレーム数
+     */
+    uint32_t dropped_count() const
+    {
+        return dropped_count_;
+    }
+
+private:
+    bool push(const gn10_can::CANFrame& frame)
+    {
+        if (count_ >= QUEUE_DEPTH) {
+            ++dropped_count_;
+            return false;
+        }
+        queue_[(head_ + count_) % QUEUE_DEPTH] = frame;
+        ++count_;
+        return true;
+    }
+
+    LoopbackCANDriver* peer_ = nullptr;
+    IFrameTap* tap_          = nullptr;
+    std::array<gn10_can::CANFrame, QUEUE_DEPTH> queue_{};
+    uint8_t head_           = 0;
+    uint8_t count_          = 0;
+    uint32_t dropped_count_ = 0;
+};
+
+}  // namespace gn10_motor::host
@@ -0,0 +1,81 @@
+/**
+ * @file motor_plant.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief ホストツール用の DC モータ + 負荷のモデル
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#pragma once
+
+#include <cstdint>
+
+namespace gn10_motor::host {
+
+/**
+ * @brief モータ + 負荷のパラメータ (エンコーダ軸換算)
+ */
+struct PlantParameters {
+    float no_load_speed_rad_s = 60.0f;  ///< デューティ比 1.0 での定常速度 [rad/s]
+    float time_constant_s     = 0.05f;  ///< 機械時定数 [s]
+    float friction_duty       = 0.02f;  ///< クーロン摩擦 (釣り合うデューティ比で表す)
+};
+
+/**
+ * @brief デューティ比を入力とする 1 次遅れのモータモデル
+ *
+ *   τ dω/dt = ω_max (d - d_f sgn(ω)) - ω
+ *
+ * 静止中は |d| が摩擦 d_f 以下なら動かない。
+ * 角度をエンコーダのカウントに量子化し、前回からの差分を IEncoder と同じ形で返す。
+ */
+class MotorPlant
+{
+public:
+    /**
+     * @brief コンストラクタ
+     * @param params         モータ + 負荷のパラメータ
+     * @param counts_per_rev エンコーダ 1 回転あたりのカウント数
+     */
+    MotorPlant(const PlantParameters& params, uint16_t counts_per_rev);
+
+    /**
+     * @brief 1 ステップ進める
+     * @param duty ゲートドライバの出力 [-1.0, 1.0]
+     * @param dt_s 時間刻み [s]
+     */
+    void step(float duty, float dt_s);
+
+    /**
+     * @brief 前回呼び出しからのエンコーダカウントの差分を返す
+     * @return int16_t 差分カウント (IEncoder::read_and_reset_count() と同じ意味)
+     */
+    int16_t take_count();
+
+    /**
+     * @brief 状態を静止・原点に戻す
+     */
+    void reset();
+
+    float velocity_rad_s() const
+    {
+        return velocity_rad_s_;
+    }
+
+    double angle_rad() const
+    {
+        return angle_rad_;
+    }
+
+private:
+    PlantParameters params_;
+    const uint16_t counts_per_rev_;
+    float velocity_rad_s_ = 0.0f;
+    double angle_rad_     = 0.0;  ///< 長時間の積算で量子化がずれないよう double で保持
+    int64_t last_count_   = 0;
+};
+
+}  // namespace gn10_motor::host
@@ -0,0 +1,147 @@
+/**
+ * @file motor_rig.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief MotorController を実機と同じ構成でホスト上に組み立てる
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "gn10_can/core/can_bus.hpp"
+#include "gn10_can/devices/motor_driver_client.hpp"
+#include "gn10_can/devices/motor_driver_server.hpp"
+#include "gn10_motor/extension_server.hpp"
+#include "gn10_motor/motor_controller.hpp"
+#include "gn10_motor/parameter_store.hpp"
+#include "host_common/fake_hardware.hpp"
+#include "host_common/frame_tap.hpp"
+#include "host_common/loopback_can_driver.hpp"
+
+namespace gn10_motor::host {
+
+/**
+ * @brief ホスト上の 1 ボード分の制御系
+ *
+ * ボード側は app.cpp と同じ順で CANBus・MotorDriverServer・ExtensionServer・
+ * MotorController を組み立て、ホスト側の MotorDriverClient とループバックでつなぐ。
+ * 設定・ゲイン・目標値は実機と同じく gn10_can のフレームとして届く。
+ *
+ * tick() は実機の CAN 受信割り込みとタイマー割り込みを 1 制御周期分まとめて実行する。
+ */
+class MotorRig
+{
+public:
+    /// エンコーダ 1 回転あたりのカウント数 (実機と同じ)
+    static constexpr uint16_t ENCODER_COUNTS_PER_REV = 4096U;
+
+    /**
+     * @brief コンストラクタ
+     * @param board_id           ボード ID [0-15]
+     * @param max_payload_length 拡張応答の最大ペイロード長 (8: クラシック CAN, 64: CAN FD)
+     */
+    explicit MotorRig(uint8_t board_id, uint8_t max_payload_length = 8U);
+
+    MotorRig(const MotorRig&)            = delete;
+    MotorRig& operator=(const MotorRig&) = delete;
+
+    /**
+     * @brief init とゲインをホストから送信し、ボードへ届ける
+     * @param config モータ設定
+     * @param gains  {kp, ki, kd}
+     */
+    void configure(const gn10_can::devices::MotorConfig& config, const std::array<float, 3>& gains);
+
+    /**
+     * @brief 目標値をホストから送信する (次の tick() で受信される)
+     * @param target 目標値
+     */
+    void send_target(float target);
+
+    /**
+     * @brief 拡張コマンドをボードへ渡す (ExtensionServer::on_receive() を直接呼ぶ)
+     * @param data   ペイロード
+     * @param length ペイロード長 [byte]
+     * @return true 自ボード宛ての拡張コマンドとして処理された
+     */
+    bool send_extension(const uint8_t* data, uint8_t length);
+
+    /**
+     * @brief 1 制御周期を実行する
+     *        ボード側の受信 → ボード時刻を進める → MotorController::update() → ホスト側の受信
+     * @param dt_s         制御周期 [s]
+     * @param limit_switch リミットスイッチの状態 (bit0 = LIM1)
+     */
+    void tick(float dt_s, uint8_t limit_switch = 0U);
+
+    /**
+     * @brief 送信フレームの受け取り先を設定する
+     * @param host_tap  ホスト (MotorDriverClient) が送信したフレームの受け取り先
+     * @param board_tap ボード (MotorDriverServer・ExtensionServer) が送信したフレームの受け取り先
+     */
+    void set_frame_taps(IFrameTap* host_tap, IFrameTap* board_tap);
+
+    FakeGateDriver& gate_driver()
+    {
+        return gate_driver_;
+    }
+
+    FakeEncoder& encoder()
+    {
+        return encoder_;
+    }
+
+    FakeClock& clock()
+    {
+        return clock_;
+    }
+
+    MotorController& controller()
+    {
+        return controller_;
+    }
+
+    ExtensionServer& extension_server()
+    {
+        return extension_server_;
+    }
+
+    gn10_can::devices::MotorDriverClient& client()
+    {
+        return client_;
+    }
+
+private:
+    /**
+     * @brief 受信キューが空になるまで CANBus の受信処理を繰り返す
+     * @param bus    受信処理を行うバス
+     * @param driver bus のドライバ
+     */
+    static void drain(gn10_can::CANBus& bus, const LoopbackCANDriver& driver);
+
+    // --- CAN バス (ホスト側・ボード側をループバックで接続) ---
+    LoopbackCANDriver host_driver_;
+    LoopbackCANDriver board_driver_;
+    gn10_can::CANBus host_bus_;
+    gn10_can::CANBus board_bus_;
+    gn10_can::devices::MotorDriverClient client_;
+    gn10_can::devices::MotorDriverServer server_;
+
+    // --- ボード側 ---
+    FakeGateDriver gate_driver_;
+    FakeEncoder encoder_;
+    FakeClock clock_;
+    NullExtensionTransmitter transmitter_;
+    RamParameterFlash parameter_flash_;
+    ParameterStore parameter_store_;
+    ExtensionServer extension_server_;
+    MotorController controller_;
+};
+
+}  // namespace gn10_motor::host
@@ -0,0 +1,73 @@
+/**
+ * @file motor_plant.cpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief ホストツール用の DC モータ + 負荷のモデルの実装
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#include "host_common/motor_plant.hpp"
+
+#include <cmath>
+
+#include "host_common/fake_hardware.hpp"
+
+namespace gn10_motor::host {
+
+MotorPlant::MotorPlant(const PlantParameters& params, uint16_t counts_per_rev)
+    : params_(params), counts_per_rev_(counts_per_rev)
+{
+}
+
+void MotorPlant::step(float duty, float dt_s)
+{
+    float effective = duty;
+    if (velocity_rad_s_ > 0.0f) {
+        effective -= params_.friction_duty;
+    } else if (velocity_rad_s_ < 0.0f) {
+        effective += params_.friction_duty;
+    } else if (std::fabs(duty) <= params_.friction_duty) {
+        // 静止摩擦で止まったまま
+        return;
+    } else if (duty > 0.0f) {
+        effective -= params_.friction_duty;
+    } else {
+        effective += params_.friction_duty;
+    }
+
+    // 1 次遅れを厳密に離散化する (dt が時定数に近くても発散しない)
+    const float target = params_.no_load_speed_rad_s * effective;
+    const float alpha  = 1.0f - std::exp(-dt_s / params_.time_constant_s);
+    const float next   = velocity_rad_s_ + alpha * (target - velocity_rad_s_);
+
+    // 摩擦で減速して符号が反転する場合は一旦止める (摩擦は運動を反転させない)
+    if (velocity_rad_s_ != 0.0f && (next > 0.0f) != (velocity_rad_s_ > 0.0f) &&
+        std::fabs(duty) <= params_.friction_duty) {
+        velocity_rad_s_ = 0.0f;
+    } else {
+        velocity_rad_s_ = next;
+    }
+    angle_rad_ += static_cast<double>(velocity_rad_s_) * static_cast<double>(dt_s);
+}
+
+int16_t MotorPlant::take_count()
+{
+    const double counts =
+        std::floor(angle_rad_ / static_cast<double>(TWO_PI) * static_cast<double>(counts_per_rev_));
+    const int64_t count = static_cast<int64_t>(counts);
+    const int64_t delta = count - last_count_;
+    last_count_         = count;
+    return static_cast<int16_t>(delta);
+}
+
+void MotorPlant::reset()
+{
+    velocity_rad_s_ = 0.0f;
+    angle_rad_      = 0.0;
+    last_count_     = 0;
+}
+
+}  // namespace gn10_motor::host
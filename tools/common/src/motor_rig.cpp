@@ -0,0 +1,81 @@
+/**
+ * @file motor_rig.cpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief ホスト上の 1 ボード分の制御系の実装
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#include "host_common/motor_rig.hpp"
+
+#include "gn10_motor/extension_protocol.hpp"
+
+namespace gn10_motor::host {
+
+// 1 制御周期 [s] をボード時刻 [us] に換算する係数
+static constexpr float US_PER_S = 1000000.0f;
+
+MotorRig::MotorRig(uint8_t board_id, uint8_t max_payload_length)
+    : host_bus_(host_driver_),
+      board_bus_(board_driver_),
+      client_(host_bus_, board_id),
+      server_(board_bus_, board_id),
+      encoder_(ENCODER_COUNTS_PER_REV),
+      transmitter_(max_payload_length),
+      parameter_store_(parameter_flash_),
+      extension_server_(board_id, transmitter_, clock_),
+      controller_(gate_driver_, encoder_, server_, extension_server_, parameter_store_)
+{
+    host_driver_.connect(board_driver_);
+    board_driver_.connect(host_driver_);
+}
+
+void MotorRig::configure(
+    const gn10_can::devices::MotorConfig& config, const std::array<float, 3>& gains
+)
+{
+    client_.send_init(config);
+    client_.send_gain(gn10_can::devices::GainType::Kp, gains[0]);
+    client_.send_gain(gn10_can::devices::GainType::Ki, gains[1]);
+    client_.send_gain(gn10_can::devices::GainType::Kd, gains[2]);
+    drain(board_bus_, board_driver_);
+}
+
+void MotorRig::send_target(float target)
+{
+    client_.send_target(target);
+}
+
+bool MotorRig::send_extension(const uint8_t* data, uint8_t length)
+{
+    return extension_server_.on_receive(
+        extension::command_id(extension_server_.board_id()), data, length
+    );
+}
+
+void MotorRig::tick(float dt_s, uint8_t limit_switch)
+{
+    drain(board_bus_, board_driver_);
+    clock_.advance_us(static_cast<uint64_t>(dt_s * US_PER_S));
+    controller_.update(dt_s, limit_switch);
+    drain(host_bus_, host_driver_);
+}
+
+void MotorRig::set_frame_taps(IFrameTap* host_tap, IFrameTap* board_tap)
+{
+    host_driver_.set_tap(host_tap);
+    board_driver_.set_tap(board_tap);
+    transmitter_.set_tap(board_tap);
+}
+
+void MotorRig::drain(gn10_can::CANBus& bus, const LoopbackCANDriver& driver)
+{
+    while (driver.pending_count() > 0U) {
+        bus.update();
+    }
+}
+
+}  // namespace gn10_motor::host
@@ -0,0 +1,70 @@
+/**
+ * @file scenarios.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief ゴールデントレースを記録する制御シナリオ
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "golden/trace.hpp"
+#include "host_common/motor_rig.hpp"
+
+namespace golden {
+
+/**
+ * @brief シナリオがホスト側から操作する入力
+ */
+struct ScenarioInput {
+    gn10_motor::host::MotorRig& rig;  ///< 設定・ゲインの送信先
+    float target;                     ///< 毎周期ホストが送る目標値
+    bool send_target;                 ///< false の間は目標値を送らない (タイムアウトの確認用)
+    uint8_t limit_switch;             ///< リミットスイッチの状態 (bit0 = LIM1)
+};
+
+/**
+ * @brief 制御シナリオ
+ *
+ * setup() で init とゲインを送り、script() で周期ごとに入力を変える。
+ * 各周期は script() → 目標値の送信 → プラントを前周期の出力で 1 ステップ進める →
+ * MotorRig::tick() の順に実行し、tick() 後の出力とプラントの状態を記録する。
+ * 名前はゴールデントレースのファイル名 (<name>.csv) になるため、変更しないこと。
+ */
+struct Scenario {
+    const char* name;  ///< コマンドラインで指定する名前
+    uint32_t cycles;   ///< 実行する制御周期の数
+    void (*setup)(ScenarioInput& input);
+    void (*script)(ScenarioInput& input, uint32_t cycle);
+};
+
+/**
+ * @brief 登録済みのシナリオの一覧を返す
+ * @param count シナリオの数の格納先
+ * @return const Scenario* 先頭要素
+ */
+const Scenario* scenarios(std::size_t& count);
+
+/**
+ * @brief 名前からシナリオを探す
+ * @param name シナリオの名前
+ * @return const Scenario* 見つからなければ nullptr
+ */
+const Scenario* find_scenario(const char* name);
+
+/**
+ * @brief シナリオを実行してトレースを返す
+ *        ボード・プラントは毎回作り直すため、結果は実行順によらない
+ * @param scenario 実行するシナリオ
+ * @return std::vector<TraceSample> 周期ごとの記録
+ */
+std::vector<TraceSample> run_scenario(const Scenario& scenario);
+
+}  // namespace golden
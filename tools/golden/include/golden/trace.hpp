@@ -0,0 +1,95 @@
+/**
+ * @file trace.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief 制御応答のトレースの保存・読み込み・比較
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace golden {
+
+/**
+ * @brief 1 制御周期分の記録
+ */
+struct TraceSample {
+    uint32_t cycle;        ///< 制御周期の番号
+    float target;          ///< MotorController が保持している目標値
+    float duty;            ///< ゲートドライバへの出力 [-1.0, 1.0]
+    float velocity_rad_s;  ///< プラントの角速度 [rad/s]
+    float angle_rad;       ///< プラントの積算角度 [rad]
+};
+
+/// TraceSample の比較対象の列の数 (cycle を除く)
+constexpr std::size_t TRACE_VALUE_COUNT = 4U;
+
+/**
+ * @brief 比較の許容誤差
+ *
+ * |actual - golden| <= abs + rel * |golden| を満たせば一致とみなす。
+ */
+struct Tolerance {
+    float abs = 1.0e-4f;  ///< 絶対誤差
+    float rel = 1.0e-3f;  ///< 相対誤差
+};
+
+/**
+ * @brief 比較結果
+ */
+struct CompareResult {
+    bool matched             = true;  ///< 全周期が許容誤差内か
+    bool length_matched      = true;  ///< 周期数が一致したか
+    std::size_t mismatches   = 0U;    ///< 許容誤差を超えた周期の数
+    uint32_t first_cycle     = 0U;    ///< 最初に許容誤差を超えた周期
+    std::size_t first_column = 0U;    ///< 最初に許容誤差を超えた列 (column_name() で名前を得る)
+    float first_actual       = 0.0f;  ///< 最初に許容誤差を超えた値
+    float first_golden       = 0.0f;  ///< そのときのゴールデンの値
+
+    float max_error[TRACE_VALUE_COUNT] = {};  ///< 列ごとの絶対誤差の最大値
+};
+
+/**
+ * @brief 列の名前を返す (CSV のヘッダと同じ)
+ * @param column 列番号 [0, TRACE_VALUE_COUNT)
+ * @return const char* 列の名前
+ */
+const char* column_name(std::size_t column);
+
+/**
+ * @brief トレースを CSV で保存する
+ * @param path    保存先のパス
+ * @param samples トレース
+ * @return true 保存できた
+ */
+bool write_trace(const char* path, const std::vector<TraceSample>& samples);
+
+/**
+ * @brief CSV のトレースを読み込む
+ * @param path    読み込むパス
+ * @param samples 読み込み先 (既存の内容は消す)
+ * @return true 読み込めた (ファイルがない・形式が違う場合は false)
+ */
+bool read_trace(const char* path, std::vector<TraceSample>& samples);
+
+/**
+ * @brief トレースをゴールデンと比較する
+ * @param actual    今回のトレース
+ * @param golden    ゴールデントレース
+ * @param tolerance 許容誤差
+ * @return CompareResult 比較結果
+ */
+CompareResult compare_traces(
+    const std::vector<TraceSample>& actual,
+    const std::vector<TraceSample>& golden,
+    const Tolerance& tolerance
+);
+
+}  // namespace golden
@@ -0,0 +1,194 @@
+/**
+ * @file golden_main.cpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief 制御応答のゴールデントレース回帰チェックのエントリポイント
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * 使い方:
+ *   gn10_golden_trace --list
+ *   gn10_golden_trace --record <dir> [--scenario <name>]
+ *   gn10_golden_trace --check <dir> [--scenario <name>] [--abs-tol <x>] [--rel-tol <x>] [--strict]
+ *
+ *   --list     シナリオの一覧を表示する
+ *   --record   シナリオを実行し、<dir>/<name>.csv にゴールデントレースを保存する
+ *   --check    シナリオを実行し、<dir>/<name>.csv と比較する (不一致があれば終了コード 1)
+ *   --scenario 指定したシナリオだけを実行する (既定: 全シナリオ)
+ *   --abs-tol  許容する絶対誤差 (既定: 1e-4)
+ *   --rel-tol  許容する相対誤差 (既定: 1e-3)
+ *   --strict   ゴールデントレースがないシナリオも失敗にする (既定: 警告のみ)
+ */
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "golden/scenarios.hpp"
+#include "golden/trace.hpp"
+
+namespace {
+
+/**
+ * @brief 実行設定
+ */
+struct Options {
+    const char* record_dir    = nullptr;
+    const char* check_dir     = nullptr;
+    const char* scenario_name = nullptr;
+    bool strict               = false;
+
+    golden::Tolerance tolerance;
+};
+
+void print_usage(const char* program)
+{
+    std::printf(
+        "usage: %s [--list] [--record <dir> | --check <dir>] [--scenario <name>]\n"
+        "          [--abs-tol <x>] [--rel-tol <x>] [--strict]\n",
+        program
+    );
+}
+
+void list_scenarios()
+{
+    std::size_t count         = 0;
+    const golden::Scenario* s = golden::scenarios(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        std::printf("%-16s %lu cycles\n", s[i].name, static_cast<unsigned long>(s[i].cycles));
+    }
+}
+
+/**
+ * @brief ゴールデントレースのパスを返す
+ */
+std::string trace_path(const char* dir, const golden::Scenario& scenario)
+{
+    return std::string(dir) + "/" + scenario.name + ".csv";
+}
+
+/**
+ * @brief シナリオを実行してゴールデントレースを保存する
+ * @return true 保存できた
+ */
+bool record(const golden::Scenario& scenario, const char* dir)
+{
+    const std::string path = trace_path(dir, scenario);
+    if (!golden::write_trace(path.c_str(), golden::run_scenario(scenario))) {
+        std::printf("%-16s FAIL  cannot write %s\n", scenario.name, path.c_str());
+        return false;
+    }
+    std::printf("%-16s saved %s\n", scenario.name, path.c_str());
+    return true;
+}
+
+/**
+ * @brief シナリオを実行してゴールデントレースと比較する
+ * @return true 一致した (ゴールデントレースがなく strict でない場合も true)
+ */
+bool check(const golden::Scenario& scenario, const Options& options)
+{
+    const std::string path = trace_path(options.check_dir, scenario);
+    std::vector<golden::TraceSample> expected;
+    if (!golden::read_trace(path.c_str(), expected)) {
+        std::printf("%-16s SKIP  no golden trace: %s\n", scenario.name, path.c_str());
+        return !options.strict;
+    }
+
+    const std::vector<golden::TraceSample> actual = golden::run_scenario(scenario);
+    const golden::CompareResult result =
+        golden::compare_traces(actual, expected, options.tolerance);
+
+    const char* verdict = "FAIL";
+    if (result.matched) {
+        verdict = "PASS";
+    }
+    std::printf("%-16s %-5s max error:", scenario.name, verdict);
+    for (std::size_t c = 0; c < golden::TRACE_VALUE_COUNT; ++c) {
+        std::printf(" %s=%.3g", golden::column_name(c), static_cast<double>(result.max_error[c]));
+    }
+    std::printf("\n");
+
+    if (!result.length_matched) {
+        std::printf(
+            "    length: %lu cycles (golden: %lu)\n",
+            static_cast<unsigned long>(actual.size()),
+            static_cast<unsigned long>(expected.size())
+        );
+    }
+    if (result.mismatches > 0U) {
+        std::printf(
+            "    %lu cycles out of tolerance, first at cycle %lu: %s = %.9g (golden: %.9g)\n",
+            static_cast<unsigned long>(result.mismatches),
+            static_cast<unsigned long>(result.first_cycle),
+            golden::column_name(result.first_column),
+            static_cast<double>(result.first_actual),
+            static_cast<double>(result.first_golden)
+        );
+    }
+    return result.matched;
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    Options options;
+
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--list") == 0) {
+            list_scenarios();
+            return EXIT_SUCCESS;
+        }
+        if (std::strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+            options.record_dir = argv[++i];
+        } else if (std::strcmp(argv[i], "--check") == 0 && i + 1 < argc) {
+            options.check_dir = argv[++i];
+        } else if (std::strcmp(argv[i], "--scenario") == 0 && i + 1 < argc) {
+            options.scenario_name = argv[++i];
+        } else if (std::strcmp(argv[i], "--abs-tol") == 0 && i + 1 < argc) {
+            options.tolerance.abs = std::strtof(argv[++i], nullptr);
+        } else if (std::strcmp(argv[i], "--rel-tol") == 0 && i + 1 < argc) {
+            options.tolerance.rel = std::strtof(argv[++i], nullptr);
+        } else if (std::strcmp(argv[i], "--strict") == 0) {
+            options.strict = true;
+        } else {
+            print_usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    // --record と --check はどちらか一方だけ指定する
+    if ((options.record_dir == nullptr) == (options.check_dir == nullptr)) {
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    std::size_t count                 = 0;
+    const golden::Scenario* scenarios = golden::scenarios(count);
+    if (options.scenario_name != nullptr) {
+        scenarios = golden::find_scenario(options.scenario_name);
+        if (scenarios == nullptr) {
+            std::printf("unknown scenario: %s\n", options.scenario_name);
+            return EXIT_FAILURE;
+        }
+        count = 1U;
+    }
+
+    bool ok = true;
+    for (std::size_t i = 0; i < count; ++i) {
+        if (options.record_dir != nullptr) {
+            ok = record(scenarios[i], options.record_dir) && ok;
+        } else {
+            ok = check(scenarios[i], options) && ok;
+        }
+    }
+    if (!ok) {
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
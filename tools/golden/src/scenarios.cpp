@@ -0,0 +1,263 @@
+/**
+ * @file scenarios.cpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief ゴールデントレースを記録する制御シナリオの実装
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#include "golden/scenarios.hpp"
+
+#include <array>
+#include <cstring>
+
+#include "gn10_motor/extension_protocol.hpp"
+#include "gn10_motor/timeout_policy.hpp"
+#include "host_common/motor_plant.hpp"
+
+namespace golden {
+
+namespace {
+
+/// 制御周期 [s] (実機の htim6 と同じ 1 ms)
+constexpr float CONTROL_DT_S = 0.001f;
+
+/// 速度制御のゲイン {kp, ki, kd}
+constexpr std::array<float, 3> SPEED_GAINS = {0.05f, 0.5f, 0.0f};
+
+/// 位置制御のゲイン {kp, ki, kd}
+constexpr std::array<float, 3> POSITION_GAINS = {0.5f, 0.0f, 0.01f};
+
+/// リミットスイッチのビット (bit0 = LIM1, bit1 = LIM2)
+constexpr uint8_t LIM1 = 0x01U;
+constexpr uint8_t LIM2 = 0x02U;
+
+/**
+ * @brief 速度制御の設定を作る
+ * @param max_duty    最大デューティ比
+ * @param accel_ratio 加速度制限 (0 で制限なし)
+ */
+gn10_can::devices::MotorConfig speed_config(float max_duty, float accel_ratio)
+{
+    gn10_can::devices::MotorConfig config;
+    config.set_encoder_type(gn10_can::devices::EncoderType::IncrementalSpeed);
+    config.set_max_duty_ratio(max_duty);
+    config.set_accel_ratio(accel_ratio);
+    return config;
+}
+
+// --- speed_step: 速度のステップ応答 (停止 → 正転 → 逆転) ---
+
+void setup_speed_step(ScenarioInput& input)
+{
+    input.rig.configure(speed_config(0.9f, 0.02f), SPEED_GAINS);
+}
+
+void script_speed_step(ScenarioInput& input, uint32_t cycle)
+{
+    if (cycle == 100U) {
+        input.target = 20.0f;
+    } else if (cycle == 600U) {
+        input.target = -10.0f;
+    }
+}
+
+// --- gain_change: 動作中のゲイン変更 (PI → ゲインを上げる → P のみ) ---
+
+void setup_gain_change(ScenarioInput& input)
+{
+    input.rig.configure(speed_config(0.9f, 0.0f), SPEED_GAINS);
+    input.target = 20.0f;
+}
+
+void script_gain_change(ScenarioInput& input, uint32_t cycle)
+{
+    auto& client = input.rig.client();
+    if (cycle == 400U) {
+        client.send_gain(gn10_can::devices::GainType::Kp, 0.1f);
+        client.send_gain(gn10_can::devices::GainType::Ki, 1.0f);
+    } else if (cycle == 700U) {
+        client.send_gain(gn10_can::devices::GainType::Ki, 0.0f);
+    }
+}
+
+// --- limit_switch: 正転中に LIM1、逆転中に LIM2 が入る ---
+
+void setup_limit_switch(ScenarioInput& input)
+{
+    gn10_can::devices::MotorConfig config = speed_config(0.9f, 0.0f);
+    config.set_forward_limit_switch(true, 0U);
+    config.set_reverse_limit_switch(true, 1U);
+    input.rig.configure(config, SPEED_GAINS);
+    input.target = 20.0f;
+}
+
+void script_limit_switch(ScenarioInput& input, uint32_t cycle)
+{
+    if (cycle == 300U) {
+        input.limit_switch = LIM1;
+    } else if (cycle == 500U) {
+        input.limit_switch = 0U;
+    } else if (cycle == 600U) {
+        input.target = -20.0f;
+    } else if (cycle == 700U) {
+        input.limit_switch = LIM2;
+    } else if (cycle == 800U) {
+        input.limit_switch = 0U;
+    }
+}
+
+// --- target_timeout: 目標値が途絶えて停止し、再開する ---
+
+void setup_target_timeout(ScenarioInput& input)
+{
+    input.rig.configure(speed_config(0.9f, 0.02f), SPEED_GAINS);
+    input.target = 20.0f;
+}
+
+void script_target_timeout(ScenarioInput& input, uint32_t cycle)
+{
+    if (cycle == 300U) {
+        input.send_target = false;
+    } else if (cycle == 700U) {
+        input.send_target = true;
+        input.target      = 10.0f;
+    }
+}
+
+// --- timeout_hold: 目標値が途絶えたら減速して速度 0 を保持し、再開する ---
+
+void setup_timeout_hold(ScenarioInput& input)
+{
+    input.rig.configure(speed_config(0.9f, 0.02f), SPEED_GAINS);
+    const uint8_t policy[3] = {
+        static_cast<uint8_t>(gn10_motor::extension::Command::SetTimeoutPolicy),
+        static_cast<uint8_t>(gn10_motor::TimeoutAction::Hold),
+        5U,  // decel_ratio = 5 / 255
+    };
+    input.rig.send_extension(policy, sizeof(policy));
+    input.target = 20.0f;
+}
+
+// --- reinit: 動作中に init を送り直す (最大デューティ比・加速度制限の変更) ---
+
+void setup_reinit(ScenarioInput& input)
+{
+    input.rig.configure(speed_config(0.9f, 0.0f), SPEED_GAINS);
+    input.target = 20.0f;
+}
+
+void script_reinit(ScenarioInput& input, uint32_t cycle)
+{
+    if (cycle == 400U) {
+        input.rig.configure(speed_config(0.3f, 0.05f), SPEED_GAINS);
+    }
+}
+
+// --- position_step: 位置制御のステップ応答 (1 回転進めて原点へ戻す) ---
+
+void setup_position_step(ScenarioInput& input)
+{
+    gn10_can::devices::MotorConfig config;
+    config.set_encoder_type(gn10_can::devices::EncoderType::IncrementalTotal);
+    config.set_max_duty_ratio(0.8f);
+    config.set_accel_ratio(0.0f);
+    input.rig.configure(config, POSITION_GAINS);
+}
+
+void script_position_step(ScenarioInput& input, uint32_t cycle)
+{
+    if (cycle == 10U) {
+        input.target = gn10_motor::host::TWO_PI;
+    } else if (cycle == 800U) {
+        input.target = 0.0f;
+    }
+}
+
+// --- open_loop: エンコーダなしのデューティ直接指定と加速度制限 ---
+
+void setup_open_loop(ScenarioInput& input)
+{
+    gn10_can::devices::MotorConfig config;
+    config.set_encoder_type(gn10_can::devices::EncoderType::None);
+    config.set_max_duty_ratio(0.9f);
+    config.set_accel_ratio(0.01f);
+    input.rig.configure(config, {0.0f, 0.0f, 0.0f});
+}
+
+void script_open_loop(ScenarioInput& input, uint32_t cycle)
+{
+    if (cycle == 10U) {
+        input.target = 0.5f;
+    } else if (cycle == 400U) {
+        input.target = -0.5f;
+    } else if (cycle == 800U) {
+        input.target = 0.0f;
+    }
+}
+
+const Scenario SCENARIOS[] = {
+    {    "speed_step", 1000U,     setup_speed_step,     script_speed_step},
+    {   "gain_change", 1000U,    setup_gain_change,    script_gain_change},
+    {  "limit_switch", 1000U,   setup_limit_switch,   script_limit_switch},
+    {"target_timeout", 1000U, setup_target_timeout, script_target_timeout},
+    {  "timeout_hold", 1000U,   setup_timeout_hold, script_target_timeout},
+    {        "reinit", 1000U,         setup_reinit,         script_reinit},
+    { "position_step", 1500U,  setup_position_step,  script_position_step},
+    {     "open_loop", 1200U,      setup_open_loop,      script_open_loop},
+};
+
+}  // namespace
+
+const Scenario* scenarios(std::size_t& count)
+{
+    count = sizeof(SCENARIOS) / sizeof(SCENARIOS[0]);
+    return SCENARIOS;
+}
+
+const Scenario* find_scenario(const char* name)
+{
+    for (const Scenario& scenario : SCENARIOS) {
+        if (std::strcmp(scenario.name, name) == 0) {
+            return &scenario;
+        }
+    }
+    return nullptr;
+}
+
+std::vector<TraceSample> run_scenario(const Scenario& scenario)
+{
+    gn10_motor::host::MotorRig rig(0U);
+    gn10_motor::host::MotorPlant plant(
+        gn10_motor::host::PlantParameters{}, gn10_motor::host::MotorRig::ENCODER_COUNTS_PER_REV
+    );
+    ScenarioInput input = {rig, 0.0f, true, 0U};
+    scenario.setup(input);
+
+    std::vector<TraceSample> samples;
+    samples.reserve(scenario.cycles);
+    for (uint32_t cycle = 0; cycle < scenario.cycles; ++cycle) {
+        scenario.script(input, cycle);
+        if (input.send_target) {
+            rig.send_target(input.target);
+        }
+
+        plant.step(rig.gate_driver().last_output(), CONTROL_DT_S);
+        rig.encoder().set_next_count(plant.take_count());
+        rig.tick(CONTROL_DT_S, input.limit_switch);
+
+        samples.push_back(TraceSample{
+            cycle,
+            rig.controller().get_target(),
+            rig.gate_driver().last_output(),
+            plant.velocity_rad_s(),
+            static_cast<float>(plant.angle_rad()),
+        });
+    }
+    return samples;
+}
+
+}  // namespace golden
@@ -0,0 +1,151 @@
+/**
+ * @file trace.cpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief 制御応答のトレースの保存・読み込み・比較の実装
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#include "golden/trace.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+namespace golden {
+
+namespace {
+
+/// CSV のヘッダ
+constexpr const char* HEADER = "cycle,target,duty,velocity_rad_s,angle_rad";
+
+/// 列の名前 (HEADER の cycle 以降と同じ順)
+constexpr const char* COLUMN_NAMES[TRACE_VALUE_COUNT] = {
+    "target", "duty", "velocity_rad_s", "angle_rad"
+};
+
+/// 1 行の最大長 [byte]
+constexpr int LINE_LENGTH = 256;
+
+/**
+ * @brief 比較する列の値を取り出す
+ */
+float value_of(const TraceSample& sample, std::size_t column)
+{
+    switch (column) {
+        case 0:
+            return sample.target;
+        case 1:
+            return sample.duty;
+        case 2:
+            return sample.velocity_rad_s;
+        default:
+            return sample.angle_rad;
+    }
+}
+
+}  // namespace
+
+const char* column_name(std::size_t column)
+{
+    if (column >= TRACE_VALUE_COUNT) {
+        return "?";
+    }
+    return COLUMN_NAMES[column];
+}
+
+bool write_trace(const char* path, const std::vector<TraceSample>& samples)
+{
+    std::FILE* file = std::fopen(path, "w");
+    if (file == nullptr) {
+        return false;
+    }
+    std::fprintf(file, "%s\n", HEADER);
+    // float を丸めずに往復できる有効桁数 (9 桁) で書く
+    for (const TraceSample& s : samples) {
+        std::fprintf(
+            file,
+            "%lu,%.9g,%.9g,%.9g,%.9g\n",
+            static_cast<unsigned long>(s.cycle),
+            static_cast<double>(s.target),
+            static_cast<double>(s.duty),
+            static_cast<double>(s.velocity_rad_s),
+            static_cast<double>(s.angle_rad)
+        );
+    }
+    return std::fclose(file) == 0;
+}
+
+bool read_trace(const char* path, std::vector<TraceSample>& samples)
+{
+    samples.clear();
+    std::FILE* file = std::fopen(path, "r");
+    if (file == nullptr) {
+        return false;
+    }
+
+    char line[LINE_LENGTH];
+    bool ok = std::fgets(line, sizeof(line), file) != nullptr &&
+              std::strncmp(line, HEADER, std::strlen(HEADER)) == 0;
+    while (ok && std::fgets(line, sizeof(line), file) != nullptr) {
+        unsigned long cycle = 0;
+        TraceSample s{};
+        const int fields = std::sscanf(
+            line, "%lu,%f,%f,%f,%f", &cycle, &s.target, &s.duty, &s.velocity_rad_s, &s.angle_rad
+        );
+        if (fields != 5) {
+            ok = false;
+            break;
+        }
+        s.cycle = static_cast<uint32_t>(cycle);
+        samples.push_back(s);
+    }
+    std::fclose(file);
+    return ok;
+}
+
+CompareResult compare_traces(
+    const std::vector<TraceSample>& actual,
+    const std::vector<TraceSample>& golden,
+    const Tolerance& tolerance
+)
+{
+    CompareResult result;
+    result.length_matched = actual.size() == golden.size();
+    result.matched        = result.length_matched;
+
+    const std::size_t count = std::min(actual.size(), golden.size());
+    for (std::size_t i = 0; i < count; ++i) {
+        bool row_matched = actual[i].cycle == golden[i].cycle;
+        for (std::size_t c = 0; c < TRACE_VALUE_COUNT; ++c) {
+            const float a     = value_of(actual[i], c);
+            const float g     = value_of(golden[i], c);
+            const float error = std::fabs(a - g);
+            if (error > result.max_error[c]) {
+                result.max_error[c] = error;
+            }
+            // NaN は許容誤差の比較が常に false になるため、不一致として数える
+            if (error <= tolerance.abs + tolerance.rel * std::fabs(g)) {
+                continue;
+            }
+            if (row_matched && result.mismatches == 0U) {
+                result.first_cycle  = golden[i].cycle;
+                result.first_column = c;
+                result.first_actual = a;
+                result.first_golden = g;
+            }
+            row_matched = false;
+        }
+        if (!row_matched) {
+            ++result.mismatches;
+            result.matched = false;
+        }
+    }
+    return result;
+}
+
+}  // namespace golden
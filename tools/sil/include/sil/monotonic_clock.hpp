@@ -0,0 +1,71 @@
+/**
+ * @file monotonic_clock.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief CLOCK_MONOTONIC によるボード時刻
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#pragma once
+
+#include <time.h>
+
+#include <cstdint>
+
+#include "gn10_motor/i_clock.hpp"
+
+namespace sil {
+
+/// 1 秒あたりのナノ秒
+constexpr uint64_t NS_PER_S = 1000000000ULL;
+
+/// 1 マイクロ秒あたりのナノ秒
+constexpr uint64_t NS_PER_US = 1000ULL;
+
+/**
+ * @brief CLOCK_MONOTONIC の現在値を返す
+ * @return uint64_t 現在時刻 [ns]
+ */
+inline uint64_t monotonic_ns()
+{
+    timespec now = {};
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<uint64_t>(now.tv_sec) * NS_PER_S + static_cast<uint64_t>(now.tv_nsec);
+}
+
+/**
+ * @brief ナノ秒を timespec に変換する
+ * @param ns 時間 [ns]
+ * @return timespec 変換結果
+ */
+inline timespec to_timespec(uint64_t ns)
+{
+    timespec result = {};
+    result.tv_sec   = static_cast<time_t>(ns / NS_PER_S);
+    result.tv_nsec  = static_cast<long>(ns % NS_PER_S);
+    return result;
+}
+
+/**
+ * @brief 生成時点を起動時刻とするボード時刻
+ *
+ * 実機の DWTClock と同じくフリーランで、ホストとの時刻同期の補正は ExtensionServer が行う。
+ */
+class MonotonicClock : public gn10_motor::IClock
+{
+public:
+    MonotonicClock() : origin_ns_(monotonic_ns()) {}
+
+    uint64_t now_us() override
+    {
+        return (monotonic_ns() - origin_ns_) / NS_PER_US;
+    }
+
+private:
+    const uint64_t origin_ns_;
+};
+
+}  // namespace sil
@@ -0,0 +1,133 @@
+/**
+ * @file sim_board.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief SocketCAN につながる 1 ボード分の模擬ボード
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "gn10_can/core/can_bus.hpp"
+#include "gn10_can/devices/motor_driver_server.hpp"
+#include "gn10_motor/extension_server.hpp"
+#include "gn10_motor/motor_controller.hpp"
+#include "gn10_motor/parameter_store.hpp"
+#include "host_common/fake_hardware.hpp"
+#include "host_common/motor_plant.hpp"
+#include "sil/monotonic_clock.hpp"
+#include "sil/socketcan_driver.hpp"
+
+namespace sil {
+
+/**
+ * @brief 模擬ボードの実行統計 (集計スレッドから読む)
+ */
+struct BoardStats {
+    std::atomic<uint64_t> ticks{0};           ///< 実行した制御周期の数
+    std::atomic<uint64_t> missed_ticks{0};    ///< 間に合わず飛ばした制御周期の数
+    std::atomic<uint64_t> latency_sum_ns{0};  ///< 制御周期の開始遅れの合計 [ns]
+    std::atomic<uint32_t> max_latency_ns{0};  ///< 制御周期の開始遅れの最大値 [ns]
+};
+
+/**
+ * @brief SocketCAN につながる 1 ボード分の制御系とモータモデル
+ *
+ * app.cpp と同じ順で CANBus・MotorDriverServer・ExtensionServer・MotorController を
+ * 組み立てる。run() を専用スレッドで呼ぶと、CAN 受信を割り込みと同じく到着時に処理しつつ、
+ * 絶対時刻で起床して制御周期ごとに MotorController::update() とモータモデルを進める。
+ */
+class SimBoard
+{
+public:
+    /// エンコーダ 1 回転あたりのカウント数 (実機と同じ)
+    static constexpr uint16_t ENCODER_COUNTS_PER_REV = 4096U;
+
+    /**
+     * @brief コンストラクタ
+     * @param board_id ボード ID [0-15]
+     * @param plant    モータ + 負荷のパラメータ
+     */
+    SimBoard(uint8_t board_id, const gn10_motor::host::PlantParameters& plant);
+
+    SimBoard(const SimBoard&)            = delete;
+    SimBoard& operator=(const SimBoard&) = delete;
+
+    /**
+     * @brief CAN インターフェースを開き、保存済みパラメータを読み込む
+     * @param interface インターフェース名
+     * @param fd_frames 拡張応答に CAN FD を使うか
+     * @return true 成功 (失敗時は errno が設定される)
+     */
+    bool open(const char* interface, bool fd_frames);
+
+    /**
+     * @brief running が false になるまで制御ループを実行する
+     * @param running   実行継続フラグ
+     * @param start_ns  最初の制御周期の時刻 (CLOCK_MONOTONIC) [ns]
+     * @param period_ns 制御周期 [ns]
+     */
+    void run(const std::atomic<bool>& running, uint64_t start_ns, uint64_t period_ns);
+
+    uint8_t board_id() const
+    {
+        return board_id_;
+    }
+
+    const BoardStats& stats() const
+    {
+        return stats_;
+    }
+
+    /**
+     * @brief 送信に失敗したフレーム数を返す
+     * @return uint32_t gn10_can と拡張応答の送信失敗数の合計
+     */
+    uint32_t tx_error_count() const
+    {
+        return can_driver_.tx_error_count() + extension_socket_.tx_error_count();
+    }
+
+private:
+    /**
+     * @brief 1 制御周期を実行する (実機のタイマー割り込みに相当)
+     * @param dt_s 制御周期 [s]
+     */
+    void tick(float dt_s);
+
+    /**
+     * @brief 制御周期の開始遅れを統計に加える
+     * @param latency_ns 開始遅れ [ns]
+     */
+    void record_latency(uint64_t latency_ns);
+
+    const uint8_t board_id_;
+
+    // --- CAN ---
+    SocketCANDriver can_driver_;
+    ExtensionSocket extension_socket_;
+    gn10_can::CANBus can_bus_;
+    gn10_can::devices::MotorDriverServer server_;
+
+    // --- ボード ---
+    gn10_motor::host::FakeGateDriver gate_driver_;
+    gn10_motor::host::FakeEncoder encoder_;
+    MonotonicClock clock_;
+    gn10_motor::host::RamParameterFlash parameter_flash_;
+    gn10_motor::ParameterStore parameter_store_;
+    gn10_motor::ExtensionServer extension_server_;
+    gn10_motor::MotorController controller_;
+
+    // --- モータ ---
+    gn10_motor::host::MotorPlant plant_;
+
+    BoardStats stats_;
+};
+
+}  // namespace sil
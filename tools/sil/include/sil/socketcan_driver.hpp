@@ -0,0 +1,136 @@
+/**
+ * @file socketcan_driver.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief Linux SocketCAN 用の gn10_can ドライバと拡張コマンド送受信ポート
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "gn10_can/core/can_frame.hpp"
+#include "gn10_can/drivers/driver_interface.hpp"
+#include "gn10_motor/extension_server.hpp"
+#include "gn10_motor/i_extension_transmitter.hpp"
+
+namespace sil {
+
+/**
+ * @brief SocketCAN の RAW ソケットを所有する基底クラス
+ *
+ * ソケットはノンブロッキングで開く。送信キュー (qdisc) が満杯のときは送信を諦めて数える。
+ */
+class SocketCANSocket
+{
+public:
+    SocketCANSocket() = default;
+    ~SocketCANSocket();
+
+    SocketCANSocket(const SocketCANSocket&)            = delete;
+    SocketCANSocket& operator=(const SocketCANSocket&) = delete;
+
+    /**
+     * @brief ファイルディスクリプタを返す (poll 用)
+     * @return int ファイルディスクリプタ (未オープンなら -1)
+     */
+    int fd() const
+    {
+        return fd_;
+    }
+
+    /**
+     * @brief 送信に失敗したフレーム数を返す
+     * @return uint32_t 送信失敗数 (主に送信キューの溢れ)
+     */
+    uint32_t tx_error_count() const
+    {
+        return tx_error_count_.load(std::memory_order_relaxed);
+    }
+
+protected:
+    /**
+     * @brief ソケットを開き、インターフェースにバインドする
+     * @param interface  インターフェース名 (例: "vcan0")
+     * @param fd_frames  CAN FD フレームを送受信するか (インターフェースの MTU が 72 であること)
+     * @return true 成功 (失敗時は errno が設定される)
+     */
+    bool open_socket(const char* interface, bool fd_frames);
+
+    int fd_ = -1;
+    std::atomic<uint32_t> tx_error_count_{0};  ///< 集計スレッドから読むため atomic
+};
+
+/**
+ * @brief DriverSTM32FDCAN と同じ gn10_can::drivers::DriverInterface を SocketCAN で実装したドライバ
+ *
+ * 実機の Rx FIFO0 と同じく、カーネルの受信フィルタで自ボード宛ての gn10_can フレームだけを
+ * 受け取る (拡張プロトコルの ID 帯・拡張 ID・リモートフレームは除外する)。
+ */
+class SocketCANDriver : public SocketCANSocket, public gn10_can::drivers::DriverInterface
+{
+public:
+    /**
+     * @brief ソケットを開き、受信フィルタを設定する
+     * @param interface インターフェース名
+     * @param board_id  ボード ID [0-15]
+     * @return true 成功
+     */
+    bool open(const char* interface, uint8_t board_id);
+
+    /**
+     * @brief ソケットを開き、何も受信しないよう設定する (送信専用のホスト側で使う)
+     * @param interface インターフェース名
+     * @return true 成功
+     */
+    bool open_transmit_only(const char* interface);
+
+    bool send(const gn10_can::CANFrame& frame) override;
+
+    bool receive(gn10_can::CANFrame& frame) override;
+
+    /**
+     * @brief 受信待ちのフレームがあるか
+     * @return true 次の receive() がフレームを返す
+     */
+    bool readable() const;
+};
+
+/**
+ * @brief 拡張コマンドを受信して ExtensionServer へ渡し、応答を送信するポート
+ *
+ * 実機の ExtensionCANPort (Rx FIFO1) に相当し、自ボード宛てのコマンドとブロードキャストだけを
+ * 受信する。fd_frames が true なら 8 byte を超える応答を CAN FD で送信する。
+ */
+class ExtensionSocket : public SocketCANSocket, public gn10_motor::IExtensionTransmitter
+{
+public:
+    /**
+     * @brief ソケットを開き、受信フィルタを設定する
+     * @param interface インターフェース名
+     * @param board_id  ボード ID [0-15]
+     * @param fd_frames CAN FD を使うか
+     * @return true 成功
+     */
+    bool open(const char* interface, uint8_t board_id, bool fd_frames);
+
+    /**
+     * @brief 受信済みのコマンドをすべて ExtensionServer へ渡す
+     * @param server 受信フレームの渡し先
+     */
+    void on_readable(gn10_motor::ExtensionServer& server);
+
+    bool send(uint32_t id, const uint8_t* data, uint8_t length) override;
+
+    uint8_t max_payload_length() const override;
+
+private:
+    bool fd_frames_ = false;
+};
+
+}  // namespace sil
@@ -0,0 +1,349 @@
+/**
+ * @file sil_main.cpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief SocketCAN (vcan) 上で複数の模擬ボードを動かす SIL ランナー
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * 使い方:
+ *   gn10_motor_sil [--interface <name>] [--boards <n>] [--first-id <id>] [--duration <s>]
+ *                  [--fd] [--realtime <priority>] [--drive]
+ *
+ *   --interface   CAN インターフェース (既定: vcan0)
+ *   --boards      模擬ボードの数 (既定: 16。board_id は 4 bit のため 1 バスに 16 台まで)
+ *   --first-id    最初のボード ID (既定: 0)
+ *   --duration    実行時間 [s] (既定: 0 = Ctrl-C まで)
+ *   --fd          拡張応答に CAN FD を使う (インターフェースの MTU を 72 にしておくこと)
+ *   --realtime    各スレッドを SCHED_FIFO の指定優先度で動かし、メモリをロックする
+ *   --drive       ホスト側から init・ゲインと 1 kHz の目標値を全ボードへ送る
+ */
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <cmath>
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "gn10_can/core/can_bus.hpp"
+#include "gn10_can/devices/motor_driver_client.hpp"
+#include "host_common/fake_hardware.hpp"
+#include "sil/monotonic_clock.hpp"
+#include "sil/sim_board.hpp"
+#include "sil/socketcan_driver.hpp"
+
+namespace {
+
+/// 制御周期 [ns] (実機の htim6 と同じ 1 ms)
+constexpr uint64_t CONTROL_PERIOD_NS = 1000000ULL;
+
+/// 1 バスに置けるボード数 (board_id は DIP スイッチ 4 bit)
+constexpr uint32_t MAX_BOARDS = 16U;
+
+/// 統計の表示間隔 [s]
+constexpr uint64_t REPORT_INTERVAL_S = 1U;
+
+/// スレッド起動から最初の制御周期までの猶予 [ns]
+constexpr uint64_t START_DELAY_NS = 100000000ULL;
+
+// --- --drive の設定 ---
+
+/// 速度制御のゲイン {kp, ki, kd} (bench の motor_controller と同じ)
+constexpr std::array<float, 3> DRIVE_GAINS = {0.05f, 0.5f, 0.0f};
+
+/// 目標速度の振幅 [rad/s]
+constexpr float DRIVE_AMPLITUDE_RAD_S = 30.0f;
+
+/// 目標速度の周波数 [Hz]
+constexpr float DRIVE_FREQUENCY_HZ = 1.0f;
+
+struct Options {
+    const char* interface = "vcan0";
+    uint32_t boards       = MAX_BOARDS;
+    uint32_t first_id     = 0U;
+    uint32_t duration_s   = 0U;
+    bool fd_frames        = false;
+    int realtime_priority = 0;  ///< 0: 通常のスケジューリング
+    bool drive            = false;
+};
+
+volatile std::sig_atomic_t interrupted = 0;
+
+void on_signal(int /*signal*/)
+{
+    interrupted = 1;
+}
+
+void print_usage(const char* program)
+{
+    std::printf(
+        "usage: %s [--interface <name>] [--boards <n>] [--first-id <id>] [--duration <s>]\n"
+        "          [--fd] [--realtime <priority>] [--drive]\n",
+        program
+    );
+}
+
+bool parse_options(int argc, char** argv, Options& options)
+{
+    for (int i = 1; i < argc; ++i) {
+        const bool has_value = i + 1 < argc;
+        if (std::strcmp(argv[i], "--interface") == 0 && has_value) {
+            options.interface = argv[++i];
+        } else if (std::strcmp(argv[i], "--boards") == 0 && has_value) {
+            options.boards = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(argv[i], "--first-id") == 0 && has_value) {
+            options.first_id = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(argv[i], "--duration") == 0 && has_value) {
+            options.duration_s = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(argv[i], "--fd") == 0) {
+            options.fd_frames = true;
+        } else if (std::strcmp(argv[i], "--realtime") == 0 && has_value) {
+            options.realtime_priority = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--drive") == 0) {
+            options.drive = true;
+        } else {
+            return false;
+        }
+    }
+    return options.boards > 0U && options.first_id + options.boards <= MAX_BOARDS;
+}
+
+/**
+ * @brief スレッドを SCHED_FIFO にする (権限がなければ警告して通常のまま動かす)
+ * @param thread   対象スレッド
+ * @param priority SCHED_FIFO の優先度 (0 なら何もしない)
+ */
+void set_realtime(std::thread& thread, int priority)
+{
+    if (priority <= 0) {
+        return;
+    }
+    sched_param param    = {};
+    param.sched_priority = priority;
+    const int result     = pthread_setschedparam(thread.native_handle(), SCHED_FIFO, &param);
+    if (result != 0) {
+        std::fprintf(stderr, "warning: SCHED_FIFO: %s\n", std::strerror(result));
+    }
+}
+
+/**
+ * @brief ホスト側: init・ゲインを送り、制御周期ごとに全ボードへ正弦波の目標速度を送る
+ * @param options   実行設定
+ * @param running   実行継続フラグ
+ * @param start_ns  最初の送信時刻 [ns]
+ * @param tx_errors 送信失敗数の書き込み先
+ */
+void drive_boards(
+    const Options& options,
+    const std::atomic<bool>& running,
+    uint64_t start_ns,
+    std::atomic<uint32_t>& tx_errors
+)
+{
+    sil::SocketCANDriver driver;
+    if (!driver.open_transmit_only(options.interface)) {
+        std::fprintf(stderr, "drive: %s: %s\n", options.interface, std::strerror(errno));
+        return;
+    }
+    gn10_can::CANBus bus(driver);
+
+    std::vector<std::unique_ptr<gn10_can::devices::MotorDriverClient>> clients;
+    for (uint32_t i = 0; i < options.boards; ++i) {
+        clients.push_back(std::make_unique<gn10_can::devices::MotorDriverClient>(
+            bus, static_cast<uint8_t>(options.first_id + i)
+        ));
+    }
+
+    gn10_can::devices::MotorConfig config;
+    config.set_encoder_type(gn10_can::devices::EncoderType::IncrementalSpeed);
+    config.set_max_duty_ratio(0.9f);
+    config.set_accel_ratio(0.02f);
+    for (auto& client : clients) {
+        client->send_init(config);
+        client->send_gain(gn10_can::devices::GainType::Kp, DRIVE_GAINS[0]);
+        client->send_gain(gn10_can::devices::GainType::Ki, DRIVE_GAINS[1]);
+        client->send_gain(gn10_can::devices::GainType::Kd, DRIVE_GAINS[2]);
+    }
+
+    uint64_t deadline_ns = start_ns;
+    while (running.load(std::memory_order_relaxed)) {
+        const timespec wake = sil::to_timespec(deadline_ns);
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wake, nullptr);
+
+        const float t_s    = static_cast<float>(deadline_ns - start_ns) / sil::NS_PER_S;
+        const float phase  = gn10_motor::host::TWO_PI * DRIVE_FREQUENCY_HZ * t_s;
+        const float target = DRIVE_AMPLITUDE_RAD_S * std::sin(phase);
+        for (auto& client : clients) {
+            client->send_target(target);
+        }
+        tx_errors.store(driver.tx_error_count(), std::memory_order_relaxed);
+        deadline_ns += CONTROL_PERIOD_NS;
+    }
+}
+
+/**
+ * @brief 全ボードの統計を 1 行にまとめて表示する
+ * @param boards     模擬ボード
+ * @param elapsed_s  経過時間 [s]
+ * @param last_ticks 前回表示時の制御周期数の合計 (更新する)
+ */
+void report(
+    const std::vector<std::unique_ptr<sil::SimBoard>>& boards,
+    uint64_t elapsed_s,
+    uint64_t& last_ticks
+)
+{
+    uint64_t ticks          = 0U;
+    uint64_t missed         = 0U;
+    uint32_t max_latency_ns = 0U;
+    uint32_t tx_errors      = 0U;
+    for (const auto& board : boards) {
+        const sil::BoardStats& stats = board->stats();
+        ticks += stats.ticks.load(std::memory_order_relaxed);
+        missed += stats.missed_ticks.load(std::memory_order_relaxed);
+        max_latency_ns =
+            std::max(max_latency_ns, stats.max_latency_ns.load(std::memory_order_relaxed));
+        tx_errors += board->tx_error_count();
+    }
+    std::printf(
+        "[%4lus] %8lu ticks/s  missed %lu  max latency %7.1f us  tx errors %u\n",
+        static_cast<unsigned long>(elapsed_s),
+        static_cast<unsigned long>((ticks - last_ticks) / REPORT_INTERVAL_S),
+        static_cast<unsigned long>(missed),
+        static_cast<double>(max_latency_ns) / sil::NS_PER_US,
+        tx_errors
+    );
+    std::fflush(stdout);
+    last_ticks = ticks;
+}
+
+/**
+ * @brief ボードごとの統計を表示する
+ * @param boards 模擬ボード
+ */
+void print_summary(const std::vector<std::unique_ptr<sil::SimBoard>>& boards)
+{
+    std::printf("\n  id      ticks   missed  mean [us]   max [us]  tx errors\n");
+    for (const auto& board : boards) {
+        const sil::BoardStats& stats = board->stats();
+        const uint64_t ticks         = stats.ticks.load(std::memory_order_relaxed);
+        double mean_us               = 0.0;
+        if (ticks > 0U) {
+            mean_us = static_cast<double>(stats.latency_sum_ns.load(std::memory_order_relaxed)) /
+                      static_cast<double>(ticks) / sil::NS_PER_US;
+        }
+        std::printf(
+            "  %2u %10lu %8lu %10.1f %10.1f %10u\n",
+            board->board_id(),
+            static_cast<unsigned long>(ticks),
+            static_cast<unsigned long>(stats.missed_ticks.load(std::memory_order_relaxed)),
+            mean_us,
+            static_cast<double>(stats.max_latency_ns.load(std::memory_order_relaxed)) /
+                sil::NS_PER_US,
+            board->tx_error_count()
+        );
+    }
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    Options options;
+    if (!parse_options(argc, argv, options)) {
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    // SCHED_FIFO で動かすときはページフォルトによる遅れを避ける
+    if (options.realtime_priority > 0 && mlockall(MCL_CURRENT | MCL_FUTURE) != 0) {
+        std::fprintf(stderr, "warning: mlockall: %s\n", std::strerror(errno));
+    }
+
+    // ボードごとにモータの時定数を少しずつ変え、全ボードが同じ応答にならないようにする
+    std::vector<std::unique_ptr<sil::SimBoard>> boards;
+    for (uint32_t i = 0; i < options.boards; ++i) {
+        gn10_motor::host::PlantParameters plant;
+        plant.time_constant_s += 0.005f * static_cast<float>(i);
+
+        const auto board_id = static_cast<uint8_t>(options.first_id + i);
+        auto board          = std::make_unique<sil::SimBoard>(board_id, plant);
+        if (!board->open(options.interface, options.fd_frames)) {
+            std::fprintf(stderr, "%s: %s\n", options.interface, std::strerror(errno));
+            return EXIT_FAILURE;
+        }
+        boards.push_back(std::move(board));
+    }
+
+    std::signal(SIGINT, on_signal);
+    std::signal(SIGTERM, on_signal);
+
+    std::atomic<bool> running{true};
+    std::atomic<uint32_t> drive_tx_errors{0};
+    const uint64_t start_ns = sil::monotonic_ns() + START_DELAY_NS;
+
+    // 実機のボードは互いに独立に起動するため、制御周期の位相をボードごとにずらす
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < options.boards; ++i) {
+        const uint64_t phase_ns = CONTROL_PERIOD_NS * i / options.boards;
+        sil::SimBoard& board    = *boards[i];
+        threads.emplace_back([&board, &running, start_ns, phase_ns]() {
+            board.run(running, start_ns + phase_ns, CONTROL_PERIOD_NS);
+        });
+        set_realtime(threads.back(), options.realtime_priority);
+    }
+    if (options.drive) {
+        threads.emplace_back([&options, &running, start_ns, &drive_tx_errors]() {
+            drive_boards(options, running, start_ns, drive_tx_errors);
+        });
+        set_realtime(threads.back(), options.realtime_priority);
+    }
+
+    const char* frame_format = "";
+    if (options.fd_frames) {
+        frame_format = " (CAN FD)";
+    }
+    std::printf(
+        "%u boards (id %u-%u) on %s%s\n",
+        options.boards,
+        options.first_id,
+        options.first_id + options.boards - 1U,
+        options.interface,
+        frame_format
+    );
+
+    uint64_t elapsed_s  = 0U;
+    uint64_t last_ticks = 0U;
+    uint64_t report_ns  = start_ns;
+    while (interrupted == 0 && (options.duration_s == 0U || elapsed_s < options.duration_s)) {
+        report_ns += REPORT_INTERVAL_S * sil::NS_PER_S;
+        const timespec wake = sil::to_timespec(report_ns);
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wake, nullptr);
+        elapsed_s += REPORT_INTERVAL_S;
+        report(boards, elapsed_s, last_ticks);
+    }
+
+    running.store(false, std::memory_order_relaxed);
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    print_summary(boards);
+    if (options.drive) {
+        std::printf("  host tx errors %u\n", drive_tx_errors.load(std::memory_order_relaxed));
+    }
+    return EXIT_SUCCESS;
+}
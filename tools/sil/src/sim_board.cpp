@@ -0,0 +1,115 @@
+/**
+ * @file sim_board.cpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief SocketCAN につながる 1 ボード分の模擬ボードの実装
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#include "sil/sim_board.hpp"
+
+#include <poll.h>
+
+namespace sil {
+
+SimBoard::SimBoard(uint8_t board_id, const gn10_motor::host::PlantParameters& plant)
+    : board_id_(board_id),
+      can_bus_(can_driver_),
+      server_(can_bus_, board_id),
+      encoder_(ENCODER_COUNTS_PER_REV),
+      parameter_store_(parameter_flash_),
+      extension_server_(board_id, extension_socket_, clock_),
+      controller_(gate_driver_, encoder_, server_, extension_server_, parameter_store_),
+      plant_(plant, ENCODER_COUNTS_PER_REV)
+{
+}
+
+bool SimBoard::open(const char* interface, bool fd_frames)
+{
+    if (!can_driver_.open(interface, board_id_)) {
+        return false;
+    }
+    if (!extension_socket_.open(interface, board_id_, fd_frames)) {
+        return false;
+    }
+    controller_.load_parameters();
+    return true;
+}
+
+void SimBoard::run(const std::atomic<bool>& running, uint64_t start_ns, uint64_t period_ns)
+{
+    const float dt_s = static_cast<float>(period_ns) / static_cast<float>(NS_PER_S);
+
+    // [0] gn10_can (実機の Rx FIFO0 割り込み) / [1] 拡張コマンド (Rx FIFO1 割り込み)
+    pollfd descriptors[2] = {
+        {can_driver_.fd(), POLLIN, 0},
+        {extension_socket_.fd(), POLLIN, 0},
+    };
+
+    uint64_t deadline_ns = start_ns;
+    while (running.load(std::memory_order_relaxed)) {
+        const uint64_t now_ns = monotonic_ns();
+
+        // 制御周期 (実機の TIM6 割り込み)
+        if (now_ns >= deadline_ns) {
+            record_latency(now_ns - deadline_ns);
+            tick(dt_s);
+            deadline_ns += period_ns;
+
+            // 1 周期以上遅れたら実機と同じく取りこぼした周期は実行せず、次の周期に合わせる
+            if (now_ns >= deadline_ns) {
+                const uint64_t missed = (now_ns - deadline_ns) / period_ns + 1U;
+                stats_.missed_ticks.fetch_add(missed, std::memory_order_relaxed);
+                deadline_ns += missed * period_ns;
+            }
+            continue;
+        }
+
+        // 次の制御周期まで CAN 受信を待つ
+        const timespec timeout = to_timespec(deadline_ns - now_ns);
+        if (::ppoll(descriptors, 2, &timeout, nullptr) <= 0) {
+            continue;
+        }
+
+        if ((descriptors[0].revents & POLLIN) != 0) {
+            while (can_driver_.readable()) {
+                can_bus_.update();
+            }
+        }
+
+        if ((descriptors[1].revents & POLLIN) != 0) {
+            extension_socket_.on_readable(extension_server_);
+
+            // 位相合わせ: 実機が TIM6 のカウンタを 0 にするのと同じく、1 周期後に制御周期を置く
+            if (extension_server_.get_phase_align_request()) {
+                deadline_ns = monotonic_ns() + period_ns;
+            }
+        }
+    }
+}
+
+void SimBoard::tick(float dt_s)
+{
+    // 前の制御周期の出力で 1 周期分モータを進め、その間のカウントをエンコーダに渡す
+    plant_.step(gate_driver_.last_output(), dt_s);
+    encoder_.set_next_count(plant_.take_count());
+
+    controller_.update(dt_s, 0U);
+    stats_.ticks.fetch_add(1U, std::memory_order_relaxed);
+}
+
+void SimBoard::record_latency(uint64_t latency_ns)
+{
+    stats_.latency_sum_ns.fetch_add(latency_ns, std::memory_order_relaxed);
+
+    // 書き込みはこのスレッドだけなので比較と代入を分けてよい
+    const uint32_t latency = static_cast<uint32_t>(latency_ns);
+    if (latency > stats_.max_latency_ns.load(std::memory_order_relaxed)) {
+        stats_.max_latency_ns.store(latency, std::memory_order_relaxed);
+    }
+}
+
+}  // namespace sil
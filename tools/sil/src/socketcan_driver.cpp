@@ -0,0 +1,234 @@
+/**
+ * @file socketcan_driver.cpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief Linux SocketCAN 用の gn10_can ドライバと拡張コマンド送受信ポートの実装
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#include "sil/socketcan_driver.hpp"
+
+#include <linux/can.h>
+#include <linux/can/raw.h>
+#include <net/if.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cstring>
+
+#include "gn10_motor/can_acceptance.hpp"
+#include "gn10_motor/extension_protocol.hpp"
+
+namespace sil {
+
+namespace {
+
+/// DLC コード (0-15) に対応するデータ長 [byte] (extension_can_port.cpp と同じ)
+constexpr uint8_t DLC_TO_LENGTH[16] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64};
+
+/**
+ * @brief データ長を格納できる最小の CAN FD のデータ長を返す
+ * @param length データ長 [byte] (64 以下)
+ * @return uint8_t DLC の刻みに切り上げたデータ長 [byte]
+ */
+uint8_t round_up_fd_length(uint8_t length)
+{
+    uint8_t dlc = 0U;
+    while (DLC_TO_LENGTH[dlc] < length) {
+        ++dlc;
+    }
+    return DLC_TO_LENGTH[dlc];
+}
+
+/**
+ * @brief 標準 ID のデータフレームだけに一致するカーネルの受信フィルタを作る
+ * @param filter ID / マスク
+ * @return can_filter 拡張 ID とリモートフレームを除外するフィルタ
+ */
+can_filter standard_data_filter(const gn10_motor::can_acceptance::IDFilter& filter)
+{
+    can_filter result = {};
+    result.can_id     = filter.id;
+    result.can_mask   = filter.mask | CAN_EFF_FLAG | CAN_RTR_FLAG;
+    return result;
+}
+
+/// ID 全体を照合するマスク
+constexpr uint32_t EXACT_MATCH_MASK = CAN_SFF_MASK;
+
+}  // namespace
+
+// ---------------------------------------------------------------------------
+// SocketCANSocket
+// ---------------------------------------------------------------------------
+
+SocketCANSocket::~SocketCANSocket()
+{
+    if (fd_ >= 0) {
+        ::close(fd_);
+    }
+}
+
+bool SocketCANSocket::open_socket(const char* interface, bool fd_frames)
+{
+    fd_ = ::socket(PF_CAN, SOCK_RAW | SOCK_NONBLOCK, CAN_RAW);
+    if (fd_ < 0) {
+        return false;
+    }
+
+    if (fd_frames) {
+        const int enable = 1;
+        if (::setsockopt(fd_, SOL_CAN_RAW, CAN_RAW_FD_FRAMES, &enable, sizeof(enable)) < 0) {
+            return false;
+        }
+    }
+
+    const unsigned int index = ::if_nametoindex(interface);
+    if (index == 0U) {
+        return false;
+    }
+
+    sockaddr_can address = {};
+    address.can_family   = AF_CAN;
+    address.can_ifindex  = static_cast<int>(index);
+    return ::bind(fd_, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0;
+}
+
+// ---------------------------------------------------------------------------
+// SocketCANDriver
+// ---------------------------------------------------------------------------
+
+bool SocketCANDriver::open(const char* interface, uint8_t board_id)
+{
+    if (!open_socket(interface, false)) {
+        return false;
+    }
+
+    // 実機のフィルタ [2] (自ボード宛て gn10_can) に相当する。拡張プロトコルの ID 帯を
+    // 除外するフィルタ [1] は OR で評価されるカーネルのフィルタでは書けないため receive() で除く
+    const can_filter filter =
+        standard_data_filter(gn10_motor::can_acceptance::gn10_can_filter(board_id));
+    return ::setsockopt(fd_, SOL_CAN_RAW, CAN_RAW_FILTER, &filter, sizeof(filter)) == 0;
+}
+
+bool SocketCANDriver::open_transmit_only(const char* interface)
+{
+    if (!open_socket(interface, false)) {
+        return false;
+    }
+    // フィルタ 0 個で何も受信しない
+    return ::setsockopt(fd_, SOL_CAN_RAW, CAN_RAW_FILTER, nullptr, 0) == 0;
+}
+
+bool SocketCANDriver::send(const gn10_can::CANFrame& frame)
+{
+    can_frame raw = {};
+    raw.can_id    = frame.id;
+    raw.can_dlc   = frame.dlc;
+    std::memcpy(raw.data, frame.data.data(), frame.dlc);
+
+    if (::write(fd_, &raw, sizeof(raw)) != static_cast<ssize_t>(sizeof(raw))) {
+        ++tx_error_count_;
+        return false;
+    }
+    return true;
+}
+
+bool SocketCANDriver::receive(gn10_can::CANFrame& frame)
+{
+    const auto& extension_range = gn10_motor::can_acceptance::EXTENSION_RANGE;
+
+    can_frame raw = {};
+    while (::read(fd_, &raw, sizeof(raw)) == static_cast<ssize_t>(sizeof(raw))) {
+        const uint32_t id = raw.can_id & CAN_SFF_MASK;
+        if ((id & extension_range.mask) == (extension_range.id & extension_range.mask)) {
+            continue;
+        }
+        frame.id  = id;
+        frame.dlc = raw.can_dlc;
+        std::memcpy(frame.data.data(), raw.data, raw.can_dlc);
+        return true;
+    }
+    return false;
+}
+
+bool SocketCANDriver::readable() const
+{
+    pollfd descriptor = {fd_, POLLIN, 0};
+    return ::poll(&descriptor, 1, 0) > 0 && (descriptor.revents & POLLIN) != 0;
+}
+
+// ---------------------------------------------------------------------------
+// ExtensionSocket
+// ---------------------------------------------------------------------------
+
+bool ExtensionSocket::open(const char* interface, uint8_t board_id, bool fd_frames)
+{
+    if (!open_socket(interface, fd_frames)) {
+        return false;
+    }
+    fd_frames_ = fd_frames;
+
+    // 実機のフィルタ [0] (自ボード宛て拡張コマンドとブロードキャスト) に相当する
+    const can_filter filters[] = {
+        standard_data_filter({gn10_motor::extension::command_id(board_id), EXACT_MATCH_MASK}),
+        standard_data_filter({gn10_motor::extension::BROADCAST_ID, EXACT_MATCH_MASK}),
+    };
+    return ::setsockopt(fd_, SOL_CAN_RAW, CAN_RAW_FILTER, filters, sizeof(filters)) == 0;
+}
+
+void ExtensionSocket::on_readable(gn10_motor::ExtensionServer& server)
+{
+    // CAN_RAW_FD_FRAMES が有効ならクラシック CAN も canfd_frame の先頭 CAN_MTU byte で届く
+    canfd_frame raw = {};
+    while (true) {
+        const ssize_t size = ::read(fd_, &raw, sizeof(raw));
+        if (size != static_cast<ssize_t>(CAN_MTU) && size != static_cast<ssize_t>(CANFD_MTU)) {
+            return;
+        }
+        server.on_receive(raw.can_id & CAN_SFF_MASK, raw.data, raw.len);
+    }
+}
+
+bool ExtensionSocket::send(uint32_t id, const uint8_t* data, uint8_t length)
+{
+    if (length > max_payload_length()) {
+        return false;
+    }
+
+    // 8 byte 以下はクラシック CAN で送り、非 FD ノードとの共存を保つ (実機と同じ)
+    const bool use_fd = length > gn10_motor::extension::CLASSIC_PAYLOAD_LENGTH;
+
+    canfd_frame raw = {};
+    raw.can_id      = id;
+    raw.len         = length;
+    std::memcpy(raw.data, data, length);
+
+    std::size_t size = CAN_MTU;
+    if (use_fd) {
+        // DLC の刻みに合わせて末尾を 0 で埋める
+        raw.len   = round_up_fd_length(length);
+        raw.flags = CANFD_BRS;
+        size      = CANFD_MTU;
+    }
+
+    if (::write(fd_, &raw, size) != static_cast<ssize_t>(size)) {
+        ++tx_error_count_;
+        return false;
+    }
+    return true;
+}
+
+uint8_t ExtensionSocket::max_payload_length() const
+{
+    if (fd_frames_) {
+        return gn10_motor::extension::FD_PAYLOAD_LENGTH;
+    }
+    return gn10_motor::extension::CLASSIC_PAYLOAD_LENGTH;
+}
+
+}  // namespace sil
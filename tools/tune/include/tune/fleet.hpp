@@ -0,0 +1,120 @@
+/**
+ * @file fleet.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief ばらつきのあるプラント群 (機構の個体差) の生成と並列評価
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "host_common/motor_plant.hpp"
+#include "tune/step_response.hpp"
+
+namespace tune {
+
+/**
+ * @brief 一様分布で振る範囲 [min, max]
+ */
+struct Range {
+    float min;
+    float max;
+};
+
+/**
+ * @brief プラントのパラメータの範囲
+ *        既定値は PlantParameters の既定値を中心に、慣性 (時定数) を 10 倍の幅で振る
+ */
+struct PlantRange {
+    Range no_load_speed_rad_s = {40.0f, 80.0f};  ///< デューティ比 1.0 での定常速度 [rad/s]
+    Range time_constant_s     = {0.02f, 0.2f};   ///< 機械時定数 (慣性に比例) [s]
+    Range friction_duty       = {0.0f, 0.05f};   ///< クーロン摩擦 (デューティ比)
+};
+
+/**
+ * @brief プラントのパラメータを一様分布で生成する
+ * @param range パラメータの範囲
+ * @param count 生成する数
+ * @param seed  乱数の種 (同じ種なら同じプラント群になる)
+ * @return std::vector<gn10_motor::host::PlantParameters> プラント群
+ */
+std::vector<gn10_motor::host::PlantParameters> sample_plants(
+    const PlantRange& range, std::size_t count, uint32_t seed
+);
+
+/**
+ * @brief プラント群全体での評価結果
+ */
+struct FleetScore {
+    float cost;              ///< 集約したコスト (mean_cost + worst_weight × worst_cost)
+    float mean_cost;         ///< コストの平均
+    float worst_cost;        ///< コストの最大値
+    float mean_settling_s;   ///< 整定時間の平均 [s]
+    float worst_settling_s;  ///< 整定時間の最大値 [s]
+    float mean_overshoot;    ///< オーバーシュートの平均
+    float worst_overshoot;   ///< オーバーシュートの最大値
+    float mean_effort;       ///< 制御入力の平均
+    std::size_t unsettled;   ///< 時間内に整定しなかった台数
+};
+
+/**
+ * @brief プラント群に対するゲインの評価を全コアで並列に行う
+ *
+ * evaluate() のたびにスレッドを起動し、プラントを 1 台ずつスレッドへ割り当てる。
+ * 各プラントの結果は決まった位置に書くため、スレッド数によらず同じ結果になる。
+ */
+class FleetEvaluator
+{
+public:
+    /**
+     * @brief コンストラクタ
+     * @param plants       プラント群
+     * @param config       ステップ応答の条件と重み
+     * @param worst_weight 最悪値の重み (0 で平均のみ。大きいほど最悪の個体を重視する)
+     * @param threads      スレッド数 (0 でハードウェアのスレッド数)
+     */
+    FleetEvaluator(
+        std::vector<gn10_motor::host::PlantParameters> plants,
+        const StepConfig& config,
+        float worst_weight,
+        unsigned threads
+    );
+
+    /**
+     * @brief ゲインをプラント群全体で評価する
+     * @param gains {kp, ki, kd}
+     * @return FleetScore 評価結果
+     */
+    FleetScore evaluate(const std::array<float, 3>& gains);
+
+    /**
+     * @brief 評価した回数 (evaluate() の呼び出し回数) を返す
+     */
+    uint64_t evaluations() const
+    {
+        return evaluations_;
+    }
+
+    unsigned threads() const
+    {
+        return threads_;
+    }
+
+private:
+    std::vector<gn10_motor::host::PlantParameters> plants_;
+    StepConfig config_;
+    float worst_weight_;
+    unsigned threads_;
+    std::vector<StepMetrics> metrics_;  ///< プラントごとの結果 (evaluate() の作業領域)
+    uint64_t evaluations_ = 0U;
+};
+
+}  // namespace tune
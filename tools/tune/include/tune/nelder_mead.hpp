@@ -0,0 +1,59 @@
+/**
+ * @file nelder_mead.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief Nelder-Mead 法 (滑降シンプレックス法) による最小化
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace tune {
+
+/**
+ * @brief Nelder-Mead 法の設定
+ */
+struct NelderMeadConfig {
+    std::size_t max_evaluations = 200U;    ///< 目的関数の評価回数の上限
+    double initial_step         = 0.5;     ///< 初期シンプレックスの各軸方向の幅
+    double tolerance            = 1.0e-4;  ///< シンプレックスの頂点の値の差がこれ以下で終了
+};
+
+/**
+ * @brief 最小化の結果
+ */
+struct NelderMeadResult {
+    std::vector<double> x;    ///< 最良の点
+    double value;             ///< 最良の点での目的関数の値
+    std::size_t evaluations;  ///< 目的関数の評価回数
+    std::size_t iterations;   ///< 反復回数
+    bool converged;           ///< tolerance で終了したか (false: 評価回数の上限)
+};
+
+/**
+ * @brief Nelder-Mead 法で目的関数を最小化する
+ *
+ * 勾配を使わないため、整定時間のように不連続な評価指標にも使える。
+ * 係数は標準的な値 (反射 1、拡大 2、収縮 0.5、縮小 0.5)。
+ *
+ * @param objective 目的関数
+ * @param start     初期点
+ * @param config    設定
+ * @param progress  反復ごとに (反復回数, 最良の点, 最良の値) を受け取る関数 (空でもよい)
+ * @return NelderMeadResult 結果
+ */
+NelderMeadResult nelder_mead(
+    const std::function<double(const std::vector<double>&)>& objective,
+    const std::vector<double>& start,
+    const NelderMeadConfig& config,
+    const std::function<void(std::size_t, const std::vector<double>&, double)>& progress
+);
+
+}  // namespace tune
@@ -0,0 +1,72 @@
+/**
+ * @file step_response.hpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief MotorController + MotorPlant のステップ応答と評価指標
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "host_common/motor_plant.hpp"
+
+namespace tune {
+
+/**
+ * @brief 制御モード
+ */
+enum class ControlMode : uint8_t {
+    Speed,     ///< 速度制御 (EncoderType::IncrementalSpeed、フィードバックは角速度)
+    Position,  ///< 位置制御 (EncoderType::IncrementalTotal、フィードバックは角度)
+};
+
+/**
+ * @brief ステップ応答の条件と評価の重み
+ */
+struct StepConfig {
+    ControlMode mode       = ControlMode::Speed;
+    float target           = 20.0f;  ///< ステップの大きさ [rad/s] または [rad]
+    float max_duty         = 0.9f;   ///< init の最大デューティ比
+    uint32_t cycles        = 500U;   ///< シミュレーションする制御周期の数 (1 周期 = 1 ms)
+    float settle_band      = 0.02f;  ///< 整定とみなす誤差の幅 (目標値に対する比)
+    float overshoot_weight = 2.0f;   ///< コストに対するオーバーシュート (比) の重み
+    float effort_weight    = 0.5f;   ///< コストに対する制御入力 (デューティ比の 2 乗平均) の重み
+    float unsettled_cost   = 1.0f;   ///< 時間内に整定しなかったときに加えるコスト
+};
+
+/**
+ * @brief 1 台分のステップ応答の評価結果
+ */
+struct StepMetrics {
+    float settling_s;  ///< 整定時間 [s] (整定しなければシミュレーション時間)
+    float overshoot;   ///< オーバーシュート (目標値に対する比、0 以上)
+    float effort;      ///< デューティ比の 2 乗平均
+    bool settled;      ///< 時間内に整定したか
+    float cost;        ///< 重み付きのコスト (小さいほど良い)
+};
+
+/**
+ * @brief MotorRig と MotorPlant でステップ応答をシミュレーションして評価する
+ *
+ * コストは 整定時間 / シミュレーション時間 + overshoot_weight × オーバーシュート +
+ * effort_weight × 制御入力 (+ 整定しなければ unsettled_cost)。
+ * 呼び出しごとに MotorRig とプラントを作るため、複数スレッドから同時に呼んでよい。
+ *
+ * @param gains  {kp, ki, kd}
+ * @param plant  プラントのパラメータ
+ * @param config 条件と重み
+ * @return StepMetrics 評価結果
+ */
+StepMetrics simulate_step(
+    const std::array<float, 3>& gains,
+    const gn10_motor::host::PlantParameters& plant,
+    const StepConfig& config
+);
+
+}  // namespace tune
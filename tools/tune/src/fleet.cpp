@@ -0,0 +1,105 @@
+/**
+ * @file fleet.cpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief ばらつきのあるプラント群の生成と並列評価の実装
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#include "tune/fleet.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <random>
+#include <thread>
+#include <utility>
+
+namespace tune {
+
+std::vector<gn10_motor::host::PlantParameters> sample_plants(
+    const PlantRange& range, std::size_t count, uint32_t seed
+)
+{
+    std::mt19937 random(seed);
+    auto draw = [&random](const Range& r) {
+        return std::uniform_real_distribution<float>(r.min, r.max)(random);
+    };
+
+    std::vector<gn10_motor::host::PlantParameters> plants(count);
+    for (auto& plant : plants) {
+        plant.no_load_speed_rad_s = draw(range.no_load_speed_rad_s);
+        plant.time_constant_s     = draw(range.time_constant_s);
+        plant.friction_duty       = draw(range.friction_duty);
+    }
+    return plants;
+}
+
+FleetEvaluator::FleetEvaluator(
+    std::vector<gn10_motor::host::PlantParameters> plants,
+    const StepConfig& config,
+    float worst_weight,
+    unsigned threads
+)
+    : plants_(std::move(plants)),
+      config_(config),
+      worst_weight_(worst_weight),
+      threads_(threads),
+      metrics_(plants_.size())
+{
+    if (threads_ == 0U) {
+        threads_ = std::max(1U, std::thread::hardware_concurrency());
+    }
+}
+
+FleetScore FleetEvaluator::evaluate(const std::array<float, 3>& gains)
+{
+    ++evaluations_;
+
+    // 1 台のシミュレーションは数百 us かかるため、台単位の割り当てで十分に均等になる
+    std::atomic<std::size_t> next{0U};
+    auto worker = [&]() {
+        for (std::size_t i = next.fetch_add(1U); i < plants_.size(); i = next.fetch_add(1U)) {
+            metrics_[i] = simulate_step(gains, plants_[i], config_);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (unsigned t = 1; t < threads_; ++t) {
+        workers.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : workers) {
+        thread.join();
+    }
+
+    FleetScore score{};
+    double cost_sum      = 0.0;
+    double settling_sum  = 0.0;
+    double overshoot_sum = 0.0;
+    double effort_sum    = 0.0;
+    for (const StepMetrics& m : metrics_) {
+        cost_sum += m.cost;
+        settling_sum += m.settling_s;
+        overshoot_sum += m.overshoot;
+        effort_sum += m.effort;
+        score.worst_cost       = std::max(score.worst_cost, m.cost);
+        score.worst_settling_s = std::max(score.worst_settling_s, m.settling_s);
+        score.worst_overshoot  = std::max(score.worst_overshoot, m.overshoot);
+        if (!m.settled) {
+            ++score.unsettled;
+        }
+    }
+
+    const double count    = static_cast<double>(std::max<std::size_t>(1U, metrics_.size()));
+    score.mean_cost       = static_cast<float>(cost_sum / count);
+    score.mean_settling_s = static_cast<float>(settling_sum / count);
+    score.mean_overshoot  = static_cast<float>(overshoot_sum / count);
+    score.mean_effort     = static_cast<float>(effort_sum / count);
+    score.cost            = score.mean_cost + worst_weight_ * score.worst_cost;
+    return score;
+}
+
+}  // namespace tune
@@ -0,0 +1,155 @@
+/**
+ * @file nelder_mead.cpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief Nelder-Mead 法による最小化の実装
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#include "tune/nelder_mead.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace tune {
+
+namespace {
+
+constexpr double REFLECTION  = 1.0;
+constexpr double EXPANSION   = 2.0;
+constexpr double CONTRACTION = 0.5;
+constexpr double SHRINK      = 0.5;
+
+/**
+ * @brief from + ratio * (to - from) を返す
+ */
+std::vector<double> lerp(
+    const std::vector<double>& from, const std::vector<double>& to, double ratio
+)
+{
+    std::vector<double> x(from.size());
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        x[i] = from[i] + ratio * (to[i] - from[i]);
+    }
+    return x;
+}
+
+}  // namespace
+
+NelderMeadResult nelder_mead(
+    const std::function<double(const std::vector<double>&)>& objective,
+    const std::vector<double>& start,
+    const NelderMeadConfig& config,
+    const std::function<void(std::size_t, const std::vector<double>&, double)>& progress
+)
+{
+    const std::size_t n = start.size();
+    NelderMeadResult result{start, 0.0, 0U, 0U, false};
+
+    auto evaluate = [&](const std::vector<double>& x) {
+        ++result.evaluations;
+        return objective(x);
+    };
+
+    // 初期シンプレックス: 初期点と、各軸方向に initial_step だけずらした n 点
+    std::vector<std::vector<double>> points(n + 1U, start);
+    std::vector<double> values(n + 1U);
+    for (std::size_t i = 0; i < n; ++i) {
+        points[i + 1U][i] += config.initial_step;
+    }
+    for (std::size_t i = 0; i <= n; ++i) {
+        values[i] = evaluate(points[i]);
+    }
+
+    std::vector<std::size_t> order(n + 1U);
+    while (true) {
+        std::iota(order.begin(), order.end(), 0U);
+        std::sort(order.begin(), order.end(), [&values](std::size_t a, std::size_t b) {
+            return values[a] < values[b];
+        });
+        const std::size_t best  = order.front();
+        const std::size_t worst = order.back();
+        const std::size_t next  = order[n - 1U];  // 2 番目に悪い点
+
+        ++result.iterations;
+        if (progress) {
+            progress(result.iterations, points[best], values[best]);
+        }
+        if (std::fabs(values[worst] - values[best]) <= config.tolerance) {
+            result.converged = true;
+            break;
+        }
+        if (result.evaluations >= config.max_evaluations) {
+            break;
+        }
+
+        // 最悪点を除いた重心
+        std::vector<double> centroid(n, 0.0);
+        for (std::size_t i = 0; i <= n; ++i) {
+            if (i == worst) {
+                continue;
+            }
+            for (std::size_t d = 0; d < n; ++d) {
+                centroid[d] += points[i][d] / static_cast<double>(n);
+            }
+        }
+
+        const std::vector<double> reflected = lerp(centroid, points[worst], -REFLECTION);
+        const double reflected_value        = evaluate(reflected);
+
+        if (reflected_value < values[best]) {
+            // 反射点が最良なら、さらに遠くへ拡大してみる
+            const std::vector<double> expanded = lerp(centroid, points[worst], -EXPANSION);
+            const double expanded_value        = evaluate(expanded);
+            if (expanded_value < reflected_value) {
+                points[worst] = expanded;
+                values[worst] = expanded_value;
+            } else {
+                points[worst] = reflected;
+                values[worst] = reflected_value;
+            }
+            continue;
+        }
+        if (reflected_value < values[next]) {
+            points[worst] = reflected;
+            values[worst] = reflected_value;
+            continue;
+        }
+
+        // 収縮: 反射点が最悪点より良ければ外側、そうでなければ内側
+        std::vector<double> contracted;
+        double limit = values[worst];
+        if (reflected_value < values[worst]) {
+            contracted = lerp(centroid, reflected, CONTRACTION);
+            limit      = reflected_value;
+        } else {
+            contracted = lerp(centroid, points[worst], CONTRACTION);
+        }
+        const double contracted_value = evaluate(contracted);
+        if (contracted_value < limit) {
+            points[worst] = contracted;
+            values[worst] = contracted_value;
+            continue;
+        }
+
+        // 縮小: 最良点以外を最良点へ近づける
+        for (std::size_t i = 0; i <= n; ++i) {
+            if (i == best) {
+                continue;
+            }
+            points[i] = lerp(points[best], points[i], SHRINK);
+            values[i] = evaluate(points[i]);
+        }
+    }
+
+    const std::size_t best = order.front();
+    result.x               = points[best];
+    result.value           = values[best];
+    return result;
+}
+
+}  // namespace tune
@@ -0,0 +1,97 @@
+/**
+ * @file step_response.cpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief MotorController + MotorPlant のステップ応答と評価指標の実装
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ */
+#include "tune/step_response.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "host_common/motor_rig.hpp"
+
+namespace tune {
+
+namespace {
+
+/// 制御周期 [s] (実機の htim6 と同じ 1 ms)
+constexpr float CONTROL_DT_S = 0.001f;
+
+}  // namespace
+
+StepMetrics simulate_step(
+    const std::array<float, 3>& gains,
+    const gn10_motor::host::PlantParameters& plant_params,
+    const StepConfig& config
+)
+{
+    gn10_motor::host::MotorRig rig(0U);
+    gn10_motor::host::MotorPlant plant(
+        plant_params, gn10_motor::host::MotorRig::ENCODER_COUNTS_PER_REV
+    );
+
+    gn10_can::devices::MotorConfig motor_config;
+    if (config.mode == ControlMode::Speed) {
+        motor_config.set_encoder_type(gn10_can::devices::EncoderType::IncrementalSpeed);
+    } else {
+        motor_config.set_encoder_type(gn10_can::devices::EncoderType::IncrementalTotal);
+    }
+    motor_config.set_max_duty_ratio(config.max_duty);
+    motor_config.set_accel_ratio(0.0f);
+    rig.configure(motor_config, gains);
+
+    const float band      = config.settle_band * std::fabs(config.target);
+    const float direction = std::copysign(1.0f, config.target);
+    uint32_t last_outside = 0U;  // 最後に整定幅の外にいた周期 + 1
+    float peak            = 0.0f;
+    double effort_sum     = 0.0;
+    bool diverged         = false;
+
+    for (uint32_t cycle = 0; cycle < config.cycles; ++cycle) {
+        rig.send_target(config.target);
+        plant.step(rig.gate_driver().last_output(), CONTROL_DT_S);
+        rig.encoder().set_next_count(plant.take_count());
+        rig.tick(CONTROL_DT_S);
+
+        float output = plant.velocity_rad_s();
+        if (config.mode == ControlMode::Position) {
+            output = static_cast<float>(plant.angle_rad());
+        }
+        if (!std::isfinite(output)) {
+            diverged = true;
+            break;
+        }
+
+        const float duty = rig.gate_driver().last_output();
+        effort_sum += static_cast<double>(duty) * static_cast<double>(duty);
+        peak = std::max(peak, output * direction);
+        if (std::fabs(output - config.target) > band) {
+            last_outside = cycle + 1U;
+        }
+    }
+
+    StepMetrics metrics{};
+    const float duration_s = static_cast<float>(config.cycles) * CONTROL_DT_S;
+    metrics.settled        = !diverged && last_outside < config.cycles;
+    metrics.settling_s     = static_cast<float>(last_outside) * CONTROL_DT_S;
+    metrics.overshoot      = std::max(0.0f, peak / std::fabs(config.target) - 1.0f);
+    metrics.effort         = static_cast<float>(effort_sum / static_cast<double>(config.cycles));
+    if (!metrics.settled) {
+        metrics.settling_s = duration_s;
+    }
+
+    metrics.cost = metrics.settling_s / duration_s + config.overshoot_weight * metrics.overshoot +
+                   config.effort_weight * metrics.effort;
+    if (!metrics.settled) {
+        metrics.cost += config.unsettled_cost;
+    }
+    return metrics;
+}
+
+}  // namespace tune
@@ -0,0 +1,324 @@
+/**
+ * @file tune_main.cpp
+ * @author Gento Aiba (aiba-gento)
+ * @brief プラント群に対するゲインのロバスト評価と最適化のエントリポイント
+ * @version 0.2.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026 ararobo
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * 使い方:
+ *   gn10_gain_tuner [--mode <speed|position>] [--target <x>] [--gains <kp,ki,kd>]
+ *                   [--tune <pi|pd|pid>] [--samples <n>] [--cycles <n>]
+ *                   [--speed-range <min:max>] [--tau-range <min:max>]
+ *                   [--friction-range <min:max>] [--worst-weight <x>]
+ *                   [--overshoot-weight <x>] [--effort-weight <x>]
+ *                   [--max-evaluations <n>] [--threads <n>] [--seed <n>] [--evaluate]
+ *
+ *   --mode             制御モード (既定: speed)
+ *   --target           ステップの大きさ (既定: speed 20 rad/s / position 2π rad)
+ *   --gains            初期ゲイン (既定: speed 0.05,0.5,0 / position 0.5,0,0.01)
+ *   --tune             最適化するゲイン (既定: speed pi / position pd。それ以外は初期値で固定)
+ *   --samples          プラント群の台数 (既定: 256)
+ *   --cycles           ステップ応答のシミュレーション周期数 [ms] (既定: 500)
+ *   --speed-range      無負荷速度の範囲 [rad/s] (既定: 40:80)
+ *   --tau-range        機械時定数の範囲 [s] (既定: 0.02:0.2)
+ *   --friction-range   クーロン摩擦の範囲 [デューティ比] (既定: 0:0.05)
+ *   --worst-weight     最悪の個体のコストの重み (既定: 0.5)
+ *   --overshoot-weight オーバーシュートの重み (既定: 2)
+ *   --effort-weight    制御入力の重み (既定: 0.5)
+ *   --max-evaluations  最適化の評価回数の上限 (既定: 200)
+ *   --threads          スレッド数 (既定: 0 = 全コア)
+ *   --seed             プラント群の乱数の種 (既定: 1。検証用の群は seed + 1)
+ *   --evaluate         最適化せず、--gains をプラント群で評価するだけにする
+ */
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "host_common/fake_hardware.hpp"
+#include "tune/fleet.hpp"
+#include "tune/nelder_mead.hpp"
+#include "tune/step_response.hpp"
+
+namespace {
+
+/// 速度制御の初期ゲイン {kp, ki, kd} (bench / bus_sim と同じ)
+constexpr std::array<float, 3> SPEED_GAINS = {0.05f, 0.5f, 0.0f};
+
+/// 位置制御の初期ゲイン {kp, ki, kd}
+constexpr std::array<float, 3> POSITION_GAINS = {0.5f, 0.0f, 0.01f};
+
+/// 最適化を始めるときの最小のゲイン (対数で探索するため 0 から始められない)
+constexpr float MIN_START_GAIN = 1.0e-3f;
+
+/// 初期シンプレックスの幅 [桁]
+constexpr double INITIAL_STEP_DECADES = 0.5;
+
+/**
+ * @brief 実行設定
+ */
+struct Options {
+    tune::StepConfig step;
+    tune::PlantRange range;
+    std::array<float, 3> gains    = SPEED_GAINS;
+    std::array<bool, 3> free_gain = {true, true, false};  ///< 最適化する {kp, ki, kd}
+    std::size_t samples           = 256U;
+    float worst_weight            = 0.5f;
+    std::size_t max_evaluations   = 200U;
+    unsigned threads              = 0U;
+    uint32_t seed                 = 1U;
+    bool evaluate_only            = false;
+};
+
+void print_usage(const char* program)
+{
+    std::printf(
+        "usage: %s [--mode <speed|position>] [--target <x>] [--gains <kp,ki,kd>]\n"
+        "          [--tune <pi|pd|pid>] [--samples <n>] [--cycles <n>]\n"
+        "          [--speed-range <min:max>] [--tau-range <min:max>]\n"
+        "          [--friction-range <min:max>] [--worst-weight <x>]\n"
+        "          [--overshoot-weight <x>] [--effort-weight <x>]\n"
+        "          [--max-evaluations <n>] [--threads <n>] [--seed <n>] [--evaluate]\n",
+        program
+    );
+}
+
+/**
+ * @brief "min:max" を読む
+ */
+bool parse_range(const char* text, tune::Range& range)
+{
+    return std::sscanf(text, "%f:%f", &range.min, &range.max) == 2 && range.min <= range.max;
+}
+
+/**
+ * @brief "pi" / "pd" / "pid" を読む
+ */
+bool parse_free_gains(const char* text, std::array<bool, 3>& free_gain)
+{
+    if (std::strcmp(text, "pi") == 0) {
+        free_gain = {true, true, false};
+    } else if (std::strcmp(text, "pd") == 0) {
+        free_gain = {true, false, true};
+    } else if (std::strcmp(text, "pid") == 0) {
+        free_gain = {true, true, true};
+    } else {
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief コマンドライン引数を読む
+ * @return true 実行してよい
+ */
+bool parse_options(int argc, char** argv, Options& options)
+{
+    bool gains_given  = false;
+    bool target_given = false;
+    bool tune_given   = false;
+
+    for (int i = 1; i < argc; ++i) {
+        const char* arg      = argv[i];
+        const bool has_value = i + 1 < argc;
+        if (std::strcmp(arg, "--evaluate") == 0) {
+            options.evaluate_only = true;
+        } else if (!has_value) {
+            return false;
+        } else if (std::strcmp(arg, "--mode") == 0) {
+            const char* mode = argv[++i];
+            if (std::strcmp(mode, "speed") == 0) {
+                options.step.mode = tune::ControlMode::Speed;
+            } else if (std::strcmp(mode, "position") == 0) {
+                options.step.mode = tune::ControlMode::Position;
+            } else {
+                return false;
+            }
+        } else if (std::strcmp(arg, "--target") == 0) {
+            options.step.target = std::strtof(argv[++i], nullptr);
+            target_given        = true;
+        } else if (std::strcmp(arg, "--gains") == 0) {
+            std::array<float, 3>& g = options.gains;
+            if (std::sscanf(argv[++i], "%f,%f,%f", &g[0], &g[1], &g[2]) != 3) {
+                return false;
+            }
+            gains_given = true;
+        } else if (std::strcmp(arg, "--tune") == 0) {
+            if (!parse_free_gains(argv[++i], options.free_gain)) {
+                return false;
+            }
+            tune_given = true;
+        } else if (std::strcmp(arg, "--samples") == 0) {
+            options.samples = std::strtoul(argv[++i], nullptr, 10);
+        } else if (std::strcmp(arg, "--cycles") == 0) {
+            options.step.cycles = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(arg, "--speed-range") == 0) {
+            if (!parse_range(argv[++i], options.range.no_load_speed_rad_s)) {
+                return false;
+            }
+        } else if (std::strcmp(arg, "--tau-range") == 0) {
+            if (!parse_range(argv[++i], options.range.time_constant_s)) {
+                return false;
+            }
+        } else if (std::strcmp(arg, "--friction-range") == 0) {
+            if (!parse_range(argv[++i], options.range.friction_duty)) {
+                return false;
+            }
+        } else if (std::strcmp(arg, "--worst-weight") == 0) {
+            options.worst_weight = std::strtof(argv[++i], nullptr);
+        } else if (std::strcmp(arg, "--overshoot-weight") == 0) {
+            options.step.overshoot_weight = std::strtof(argv[++i], nullptr);
+        } else if (std::strcmp(arg, "--effort-weight") == 0) {
+            options.step.effort_weight = std::strtof(argv[++i], nullptr);
+        } else if (std::strcmp(arg, "--max-evaluations") == 0) {
+            options.max_evaluations = std::strtoul(argv[++i], nullptr, 10);
+        } else if (std::strcmp(arg, "--threads") == 0) {
+            options.threads = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(arg, "--seed") == 0) {
+            options.seed = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else {
+            return false;
+        }
+    }
+
+    // 位置制御の既定値
+    if (options.step.mode == tune::ControlMode::Position) {
+        if (!gains_given) {
+            options.gains = POSITION_GAINS;
+        }
+        if (!target_given) {
+            options.step.target = gn10_motor::host::TWO_PI;
+        }
+        if (!tune_given) {
+            options.free_gain = {true, false, true};
+        }
+    }
+    return options.samples > 0U && options.step.cycles > 0U && options.step.target != 0.0f;
+}
+
+void print_score(const char* label, const std::array<float, 3>& gains, const tune::FleetScore& s)
+{
+    std::printf(
+        "%-9s kp=%.5g ki=%.5g kd=%.5g  cost %.4f (mean %.4f / worst %.4f)\n",
+        label,
+        static_cast<double>(gains[0]),
+        static_cast<double>(gains[1]),
+        static_cast<double>(gains[2]),
+        static_cast<double>(s.cost),
+        static_cast<double>(s.mean_cost),
+        static_cast<double>(s.worst_cost)
+    );
+    std::printf(
+        "          settling %.1f / %.1f ms  overshoot %.1f / %.1f %%  effort %.3f  unsettled %lu\n",
+        static_cast<double>(s.mean_settling_s) * 1000.0,
+        static_cast<double>(s.worst_settling_s) * 1000.0,
+        static_cast<double>(s.mean_overshoot) * 100.0,
+        static_cast<double>(s.worst_overshoot) * 100.0,
+        static_cast<double>(s.mean_effort),
+        static_cast<unsigned long>(s.unsettled)
+    );
+}
+
+/**
+ * @brief 探索変数 (最適化するゲインの log10) をゲインに戻す
+ */
+std::array<float, 3> to_gains(const std::vector<double>& x, const Options& options)
+{
+    std::array<float, 3> gains = options.gains;
+    std::size_t d              = 0;
+    for (std::size_t g = 0; g < gains.size(); ++g) {
+        if (options.free_gain[g]) {
+            gains[g] = static_cast<float>(std::pow(10.0, x[d++]));
+        }
+    }
+    return gains;
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    Options options;
+    if (!parse_options(argc, argv, options)) {
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    tune::FleetEvaluator fleet(
+        tune::sample_plants(options.range, options.samples, options.seed),
+        options.step,
+        options.worst_weight,
+        options.threads
+    );
+    std::printf(
+        "%lu plants, %lu cycles, %u threads\n",
+        static_cast<unsigned long>(options.samples),
+        static_cast<unsigned long>(options.step.cycles),
+        fleet.threads()
+    );
+
+    const tune::FleetScore initial = fleet.evaluate(options.gains);
+    print_score("initial", options.gains, initial);
+    if (options.evaluate_only) {
+        return EXIT_SUCCESS;
+    }
+
+    // ゲインは桁で効くため log10 で探索する (負のゲインにもならない)
+    std::vector<double> start;
+    for (std::size_t g = 0; g < options.gains.size(); ++g) {
+        if (options.free_gain[g]) {
+            start.push_back(std::log10(std::max(options.gains[g], MIN_START_GAIN)));
+        }
+    }
+
+    tune::NelderMeadConfig config;
+    config.max_evaluations = options.max_evaluations;
+    config.initial_step    = INITIAL_STEP_DECADES;
+
+    const tune::NelderMeadResult result = tune::nelder_mead(
+        [&](const std::vector<double>& x) {
+            return static_cast<double>(fleet.evaluate(to_gains(x, options)).cost);
+        },
+        start,
+        config,
+        [&](std::size_t iteration, const std::vector<double>& x, double value) {
+            const std::array<float, 3> g = to_gains(x, options);
+            std::printf(
+                "iter %3lu  kp=%.5g ki=%.5g kd=%.5g  cost %.4f\n",
+                static_cast<unsigned long>(iteration),
+                static_cast<double>(g[0]),
+                static_cast<double>(g[1]),
+                static_cast<double>(g[2]),
+                value
+            );
+        }
+    );
+
+    const std::array<float, 3> best = to_gains(result.x, options);
+    const char* status = "stopped";
+    if (result.converged) {
+        status = "converged";
+    }
+    std::printf(
+        "%s after %lu evaluations\n", status, static_cast<unsigned long>(result.evaluations)
+    );
+    print_score("initial", options.gains, initial);
+    print_score("best", best, fleet.evaluate(best));
+
+    // 最適化に使っていないプラント群で、過学習していないことを確認する
+    tune::FleetEvaluator holdout(
+        tune::sample_plants(options.range, options.samples, options.seed + 1U),
+        options.step,
+        options.worst_weight,
+        options.threads
+    );
+    print_score("holdout", best, holdout.evaluate(best));
+    return EXIT_SUCCESS;
+}